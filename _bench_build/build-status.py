@@ -0,0 +1,8 @@
+#! /usr/bin/env python
+
+# Programs that are runnable.
+ns3_runnable_programs = ['src/applications/examples/ns3.29-three-gpp-http-example-optimized', 'src/bridge/examples/ns3.29-csma-bridge-optimized', 'src/bridge/examples/ns3.29-csma-bridge-one-hop-optimized', 'src/buildings/examples/ns3.29-buildings-pathloss-profiler-optimized', 'src/config-store/examples/ns3.29-config-store-save-optimized', 'src/core/examples/ns3.29-main-callback-optimized', 'src/core/examples/ns3.29-sample-simulator-optimized', 'src/core/examples/ns3.29-main-ptr-optimized', 'src/core/examples/ns3.29-main-random-variable-stream-optimized', 'src/core/examples/ns3.29-sample-random-variable-optimized', 'src/core/examples/ns3.29-sample-random-variable-stream-optimized', 'src/core/examples/ns3.29-command-line-example-optimized', 'src/core/examples/ns3.29-hash-example-optimized', 'src/core/examples/ns3.29-sample-log-time-format-optimized', 'src/core/examples/ns3.29-test-string-value-formatting-optimized', 'src/core/examples/ns3.29-event-impl-pool-benchmark-optimized', 'src/core/examples/ns3.29-scheduler-benchmark-optimized', 'src/core/examples/ns3.29-main-test-sync-optimized', 'src/csma/examples/ns3.29-csma-one-subnet-optimized', 'src/csma/examples/ns3.29-csma-broadcast-optimized', 'src/csma/examples/ns3.29-csma-packet-socket-optimized', 'src/csma/examples/ns3.29-csma-multicast-optimized', 'src/energy/examples/ns3.29-li-ion-energy-source-optimized', 'src/energy/examples/ns3.29-rv-battery-model-test-optimized', 'src/energy/examples/ns3.29-basic-energy-model-test-optimized', 'src/fd-net-device/examples/ns3.29-fd2fd-onoff-optimized', 'src/fd-net-device/examples/ns3.29-realtime-fd2fd-onoff-optimized', 'src/fd-net-device/examples/ns3.29-fd-emu-udp-echo-optimized', 'src/fd-net-device/examples/ns3.29-fd-emu-onoff-optimized', 'src/internet/examples/ns3.29-main-simple-optimized', 'src/lr-wpan/examples/ns3.29-lr-wpan-packet-print-optimized', 'src/lr-wpan/examples/ns3.29-lr-wpan-phy-test-optimized', 'src/lr-wpan/examples/ns3.29-lr-wpan-data-optimized', 'src/lr-wpan/examples/ns3.29-lr-wpan-error-model-plot-optimized', 'src/lr-wpan/examples/ns3.29-lr-wpan-error-distance-plot-optimized', 'src/lte/examples/ns3.29-lena-cqi-threshold-optimized', 'src/lte/examples/ns3.29-lena-dual-stripe-optimized', 'src/lte/examples/ns3.29-lena-fading-optimized', 'src/lte/examples/ns3.29-lena-intercell-interference-optimized', 'src/lte/examples/ns3.29-lena-ipv6-addr-conf-optimized', 'src/lte/examples/ns3.29-lena-ipv6-ue-rh-optimized', 'src/lte/examples/ns3.29-lena-ipv6-ue-ue-optimized', 'src/lte/examples/ns3.29-lena-pathloss-traces-optimized', 'src/lte/examples/ns3.29-lena-profiling-optimized', 'src/lte/examples/ns3.29-lena-stats-benchmark-optimized', 'src/lte/examples/ns3.29-lena-fading-trace-converter-optimized', 'src/lte/examples/ns3.29-lena-mi-error-model-benchmark-optimized', 'src/lte/examples/ns3.29-lena-pathloss-cache-benchmark-optimized', 'src/lte/examples/ns3.29-lena-spectrum-channel-benchmark-optimized', 'src/lte/examples/ns3.29-lena-rem-optimized', 'src/lte/examples/ns3.29-lena-rem-sector-antenna-optimized', 'src/lte/examples/ns3.29-lena-rlc-traces-optimized', 'src/lte/examples/ns3.29-lena-simple-optimized', 'src/lte/examples/ns3.29-lena-simple-epc-optimized', 'src/lte/examples/ns3.29-lena-deactivate-bearer-optimized', 'src/lte/examples/ns3.29-lena-x2-handover-optimized', 'src/lte/examples/ns3.29-lena-x2-handover-measures-optimized', 'src/lte/examples/ns3.29-lena-frequency-reuse-optimized', 'src/lte/examples/ns3.29-lena-distributed-ffr-optimized', 'src/lte/examples/ns3.29-lena-uplink-power-control-optimized', 'src/lte/examples/ns3.29-lena-simple-epc-emu-optimized', 'src/mobility/examples/ns3.29-main-grid-topology-optimized', 'src/mobility/examples/ns3.29-main-random-topology-optimized', 'src/mobility/examples/ns3.29-main-random-walk-optimized', 'src/mobility/examples/ns3.29-mobility-trace-example-optimized', 'src/mobility/examples/ns3.29-ns2-mobility-trace-optimized', 'src/mobility/examples/ns3.29-bonnmotion-ns2-example-optimized', 'src/mpi/examples/ns3.29-third-distributed-optimized', 'src/netanim/examples/ns3.29-dumbbell-animation-optimized', 'src/netanim/examples/ns3.29-grid-animation-optimized', 'src/netanim/examples/ns3.29-star-animation-optimized', 'src/netanim/examples/ns3.29-wireless-animation-optimized', 'src/netanim/examples/ns3.29-uan-animation-optimized', 'src/netanim/examples/ns3.29-colors-link-description-optimized', 'src/netanim/examples/ns3.29-resources-counters-optimized', 'src/network/examples/ns3.29-main-packet-header-optimized', 'src/network/examples/ns3.29-main-packet-tag-optimized', 'src/network/examples/ns3.29-packet-socket-apps-optimized', 'src/olsr/examples/ns3.29-simple-point-to-point-olsr-optimized', 'src/olsr/examples/ns3.29-olsr-hna-optimized', 'src/point-to-point/examples/ns3.29-main-attribute-value-optimized', 'src/propagation/examples/ns3.29-main-propagation-loss-optimized', 'src/propagation/examples/ns3.29-jakes-propagation-model-example-optimized', 'src/spectrum/examples/ns3.29-adhoc-aloha-ideal-phy-optimized', 'src/spectrum/examples/ns3.29-adhoc-aloha-ideal-phy-matrix-propagation-loss-model-optimized', 'src/spectrum/examples/ns3.29-adhoc-aloha-ideal-phy-with-microwave-oven-optimized', 'src/spectrum/examples/ns3.29-tv-trans-example-optimized', 'src/spectrum/examples/ns3.29-tv-trans-regional-example-optimized', 'src/spectrum/examples/ns3.29-spectrum-value-benchmark-optimized', 'src/stats/examples/ns3.29-gnuplot-example-optimized', 'src/stats/examples/ns3.29-double-probe-example-optimized', 'src/stats/examples/ns3.29-time-probe-example-optimized', 'src/stats/examples/ns3.29-gnuplot-aggregator-example-optimized', 'src/stats/examples/ns3.29-gnuplot-helper-example-optimized', 'src/stats/examples/ns3.29-file-aggregator-example-optimized', 'src/stats/examples/ns3.29-file-helper-example-optimized', 'src/traffic-control/examples/ns3.29-red-vs-ared-optimized', 'src/traffic-control/examples/ns3.29-pfifo-vs-red-optimized', 'src/traffic-control/examples/ns3.29-codel-vs-pfifo-basic-test-optimized', 'src/traffic-control/examples/ns3.29-codel-vs-pfifo-asymmetric-optimized', 'src/uan/examples/ns3.29-uan-cw-example-optimized', 'src/uan/examples/ns3.29-uan-rc-example-optimized', 'src/uan/examples/ns3.29-uan-raw-example-optimized', 'src/uan/examples/ns3.29-uan-ipv4-example-optimized', 'src/uan/examples/ns3.29-uan-ipv6-example-optimized', 'src/virtual-net-device/examples/ns3.29-virtual-net-device-optimized', 'src/wave/examples/ns3.29-wave-simple-80211p-optimized', 'src/wave/examples/ns3.29-wave-simple-device-optimized', 'src/wifi/examples/ns3.29-wifi-phy-test-optimized', 'src/wifi/examples/ns3.29-test-interference-helper-optimized', 'src/wifi/examples/ns3.29-wifi-manager-example-optimized', 'src/wifi/examples/ns3.29-wifi-trans-example-optimized', 'src/wifi/examples/ns3.29-wifi-phy-configuration-optimized', 'src/wimax/examples/ns3.29-wimax-ipv4-optimized', 'src/wimax/examples/ns3.29-wimax-multicast-optimized', 'src/wimax/examples/ns3.29-wimax-simple-optimized', 'contrib/simple-wireless/examples/ns3.29-directional_test-optimized', 'contrib/simple-wireless/examples/ns3.29-mixed_directional_network-optimized', 'contrib/simple-wireless/examples/ns3.29-multiple_interface_example-optimized', 'contrib/simple-wireless/examples/ns3.29-fixed_contention_test-optimized', 'contrib/simple-wireless/examples/ns3.29-error_model_test-optimized', 'contrib/simple-wireless/examples/ns3.29-link-performance-optimized', 'contrib/simple-wireless/examples/ns3.29-mm1-queue-optimized', 'contrib/simple-wireless/examples/ns3.29-slotted-aloha-optimized', 'contrib/simple-wireless/examples/ns3.29-wifi-dcf-optimized', 'contrib/simple-wireless/examples/ns3.29-simple-wireless-scaling-optimized', 'contrib/simple-wireless/examples/ns3.29-simple-wireless-broadcast-allocations-optimized', 'contrib/simple-wireless/examples/ns3.29-lte-tcp-x2-handover-optimized', 'examples/tcp/ns3.29-tcp-large-transfer-optimized', 'examples/tcp/ns3.29-tcp-nsc-lfn-optimized', 'examples/tcp/ns3.29-tcp-nsc-zoo-optimized', 'examples/tcp/ns3.29-tcp-star-server-optimized', 'examples/tcp/ns3.29-star-optimized', 'examples/tcp/ns3.29-tcp-bulk-send-optimized', 'examples/tcp/ns3.29-tcp-pcap-nanosec-example-optimized', 'examples/energy/ns3.29-energy-model-example-optimized', 'examples/energy/ns3.29-energy-model-with-harvesting-example-optimized', 'examples/routing/ns3.29-dynamic-global-routing-optimized', 'examples/routing/ns3.29-static-routing-slash32-optimized', 'examples/routing/ns3.29-global-routing-slash32-optimized', 'examples/routing/ns3.29-global-injection-slash32-optimized', 'examples/routing/ns3.29-simple-alternate-routing-optimized', 'examples/routing/ns3.29-mixed-global-routing-optimized', 'examples/routing/ns3.29-global-routing-multi-switch-plus-router-optimized', 'examples/stats/ns3.29-wifi-example-sim-optimized', 'examples/udp-client-server/ns3.29-udp-client-server-optimized', 'examples/udp-client-server/ns3.29-udp-trace-client-server-optimized', 'examples/error-model/ns3.29-simple-error-model-optimized', 'examples/wireless/ns3.29-mixed-wired-wireless-optimized', 'examples/wireless/ns3.29-wifi-adhoc-optimized', 'examples/wireless/ns3.29-wifi-clear-channel-cmu-optimized', 'examples/wireless/ns3.29-wifi-ap-optimized', 'examples/wireless/ns3.29-wifi-wired-bridging-optimized', 'examples/wireless/ns3.29-wifi-simple-adhoc-optimized', 'examples/wireless/ns3.29-wifi-simple-adhoc-grid-optimized', 'examples/wireless/ns3.29-wifi-simple-infra-optimized', 'examples/wireless/ns3.29-wifi-simple-interference-optimized', 'examples/wireless/ns3.29-wifi-blockack-optimized', 'examples/wireless/ns3.29-dsss-validation-optimized', 'examples/wireless/ns3.29-ofdm-validation-optimized', 'examples/wireless/ns3.29-ofdm-ht-validation-optimized', 'examples/wireless/ns3.29-ofdm-vht-validation-optimized', 'examples/wireless/ns3.29-ht-wifi-network-optimized', 'examples/wireless/ns3.29-vht-wifi-network-optimized', 'examples/wireless/ns3.29-wifi-timing-attributes-optimized', 'examples/wireless/ns3.29-wifi-sleep-optimized', 'examples/wireless/ns3.29-power-adaptation-distance-optimized', 'examples/wireless/ns3.29-rate-adaptation-distance-optimized', 'examples/wireless/ns3.29-wifi-aggregation-optimized', 'examples/wireless/ns3.29-simple-ht-hidden-stations-optimized', 'examples/wireless/ns3.29-80211n-mimo-optimized', 'examples/wireless/ns3.29-mixed-network-optimized', 'examples/wireless/ns3.29-wifi-tcp-optimized', 'examples/wireless/ns3.29-80211e-txop-optimized', 'examples/wireless/ns3.29-wifi-spectrum-per-example-optimized', 'examples/wireless/ns3.29-wifi-spectrum-per-interference-optimized', 'examples/wireless/ns3.29-wifi-spectrum-saturation-example-optimized', 'examples/wireless/ns3.29-ofdm-he-validation-optimized', 'examples/wireless/ns3.29-he-wifi-network-optimized', 'examples/wireless/ns3.29-wifi-multi-tos-optimized', 'examples/wireless/ns3.29-wifi-backward-compatibility-optimized', 'examples/wireless/ns3.29-wifi-pcf-optimized', 'examples/tutorial/ns3.29-hello-simulator-optimized', 'examples/tutorial/ns3.29-first-optimized', 'examples/tutorial/ns3.29-second-optimized', 'examples/tutorial/ns3.29-third-optimized', 'examples/tutorial/ns3.29-fourth-optimized', 'examples/tutorial/ns3.29-fifth-optimized', 'examples/tutorial/ns3.29-sixth-optimized', 'examples/tutorial/ns3.29-seventh-optimized', 'examples/udp/ns3.29-udp-echo-optimized', 'examples/socket/ns3.29-socket-bound-static-routing-optimized', 'examples/socket/ns3.29-socket-bound-tcp-static-routing-optimized', 'examples/socket/ns3.29-socket-options-ipv4-optimized', 'examples/socket/ns3.29-socket-options-ipv6-optimized', 'examples/realtime/ns3.29-realtime-udp-echo-optimized', 'examples/naming/ns3.29-object-names-optimized', 'examples/ipv6/ns3.29-test-ipv6-optimized', 'examples/traffic-control/ns3.29-red-vs-fengadaptive-optimized', 'examples/traffic-control/ns3.29-red-vs-nlred-optimized', 'examples/traffic-control/ns3.29-tbf-example-optimized', 'examples/matrix-topology/ns3.29-matrix-topology-optimized', 'scratch/ns3.29-playingAround-optimized', 'scratch/ns3.29-ns3-hello-world-optimized', 'scratch/subdir/ns3.29-subdir-optimized', 'scratch/ns3.29-scratch-simulator-optimized']
+
+# Scripts that are runnable.
+ns3_runnable_scripts = ['csma-bridge.py', 'sample-simulator.py', 'mixed-wired-wireless.py', 'wifi-ap.py', 'first.py', 'second.py', 'third.py', 'realtime-udp-echo.py']
+
@@ -0,0 +1,152 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef EVENT_BATCH_H
+#define EVENT_BATCH_H
+
+#include "nstime.h"
+#include "make-event.h"
+#include <stdint.h>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup events
+ * ns3::EventBatch declaration.
+ */
+
+namespace ns3 {
+
+class EventImpl;
+
+/**
+ * \ingroup events
+ * \brief A set of events, each with its own context and delay, to be
+ * scheduled together with Simulator::ScheduleBatch.
+ *
+ * This is meant for the fan-out of a transmission by a channel to all
+ * its receivers: the events are collected while the receivers are
+ * visited and then handed to the simulator in a single call, which lets
+ * the simulator implementation insert them at once (for instance with a
+ * single lock when called from another thread). Scheduling the events
+ * of a batch is equivalent to scheduling them one by one with
+ * Simulator::ScheduleWithContext, in the order in which they were added.
+ *
+ * The storage of the batch is kept when it is scheduled or cleared, so
+ * a batch reused for each transmission does not allocate memory once it
+ * has grown to the number of receivers.
+ */
+class EventBatch
+{
+public:
+  /** An event of the batch. */
+  struct Entry
+  {
+    uint32_t context;  //!< The context of the event.
+    Time delay;        //!< The delay until the event expires.
+    EventImpl *event;  //!< The event, holding one reference.
+  };
+
+  EventBatch ();
+  /** Destructor, which releases the events not scheduled. */
+  ~EventBatch ();
+
+  /**
+   * Add an event to the batch.
+   *
+   * \param [in] context The context of the event.
+   * \param [in] delay The delay until the event expires.
+   * \param [in] event The event. The batch takes over the reference
+   *        held by the caller, as Simulator::ScheduleWithContext does.
+   */
+  void Add (uint32_t context, const Time &delay, EventImpl *event);
+
+  /**
+   * Add an event to the batch, made by MakeEvent from a function or a
+   * member function and its arguments.
+   *
+   * \tparam Ts \deduced The types of the arguments of MakeEvent.
+   * \param [in] context The context of the event.
+   * \param [in] delay The delay until the event expires.
+   * \param [in] args The function or the member function pointer and
+   *        object, followed by the arguments bound to the function.
+   */
+  template <typename... Ts>
+  void Add (uint32_t context, const Time &delay, Ts... args);
+
+  /** \returns The number of events in the batch. */
+  std::size_t GetN (void) const;
+  /** \returns \c true if the batch has no event. */
+  bool IsEmpty (void) const;
+  /**
+   * \param [in] i The index of an event, in the order of addition.
+   * \returns The event.
+   */
+  const Entry & Get (std::size_t i) const;
+
+  /** Release the events of the batch without scheduling them. */
+  void Clear (void);
+
+private:
+  /** Disabled copy constructor, the batch holds references to its events. */
+  EventBatch (const EventBatch &);
+  /**
+   * Disabled assignment operator.
+   * \returns The batch.
+   */
+  EventBatch & operator = (const EventBatch &);
+
+  std::vector<Entry> m_entries;  //!< The events, in the order of addition.
+};
+
+} // namespace ns3
+
+
+/********************************************************************
+ *  Implementation of the templates declared above.
+ ********************************************************************/
+
+namespace ns3 {
+
+template <typename... Ts>
+void
+EventBatch::Add (uint32_t context, const Time &delay, Ts... args)
+{
+  Add (context, delay, MakeEvent (args...));
+}
+
+inline std::size_t
+EventBatch::GetN (void) const
+{
+  return m_entries.size ();
+}
+
+inline bool
+EventBatch::IsEmpty (void) const
+{
+  return m_entries.empty ();
+}
+
+inline const EventBatch::Entry &
+EventBatch::Get (std::size_t i) const
+{
+  return m_entries[i];
+}
+
+} // namespace ns3
+
+#endif /* EVENT_BATCH_H */
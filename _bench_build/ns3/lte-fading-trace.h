@@ -0,0 +1,145 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011 Centre Tecnologic de Telecomunicacions de Catalunya (CTTC)
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LTE_FADING_TRACE_H
+#define LTE_FADING_TRACE_H
+
+#include <ns3/simple-ref-count.h>
+#include <ns3/ptr.h>
+#include <ns3/assert.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * \ingroup lte
+ *
+ * \brief Read-only fading trace shared by all the TraceFadingLossModel
+ * instances using the same file.
+ *
+ * A trace is loaded once per process: Get () returns the already loaded
+ * trace if another model still holds it, so the memory used does not grow
+ * with the number of fading models.
+ *
+ * Two file formats are supported. The ASCII format generated by
+ * fading_trace_generator.m stores one row per RB, each with one sample per
+ * column, and has to be parsed. The binary format, written by
+ * ConvertToBinary (), is memory-mapped read-only and used in place, so
+ * loading it costs almost nothing and its pages are shared with the other
+ * processes using the same trace. A binary trace is made of
+ *
+ *   - the 8 characters "LTEFADNG"
+ *   - uint32_t 0x01020304, to detect the byte order of the file
+ *   - uint32_t format version (currently 1)
+ *   - uint32_t number of RBs
+ *   - uint32_t number of samples per RB
+ *   - the samples in dB, as doubles in native representation, RB by RB
+ *
+ * The format of a file is detected from its first bytes.
+ */
+class LteFadingTrace : public SimpleRefCount<LteFadingTrace>
+{
+public:
+  ~LteFadingTrace ();
+
+  /**
+   * Get a fading trace, loading it if it is not already loaded.
+   *
+   * \param filename the trace file, in ASCII or binary format
+   * \param rbNum the number of RBs used
+   * \param samplesNum the number of samples per RB used
+   * \return the trace
+   */
+  static Ptr<const LteFadingTrace> Get (std::string filename, uint32_t rbNum,
+                                        uint32_t samplesNum);
+
+  /**
+   * Convert an ASCII fading trace to the binary format.
+   *
+   * \param asciiFilename the ASCII trace to read
+   * \param binaryFilename the binary trace to write
+   * \param rbNum the number of RBs of the trace
+   * \param samplesNum the number of samples per RB of the trace
+   * \return true if the binary trace was written
+   */
+  static bool ConvertToBinary (std::string asciiFilename, std::string binaryFilename,
+                               uint32_t rbNum, uint32_t samplesNum);
+
+  /**
+   * \return true if the trace is memory-mapped from a binary file
+   */
+  bool IsMapped (void) const;
+
+  /**
+   * \return the number of RBs of the trace
+   */
+  uint32_t GetRbNum (void) const;
+
+  /**
+   * \return the number of samples per RB of the trace
+   */
+  uint32_t GetSamplesNum (void) const;
+
+  /**
+   * \param rb the RB index
+   * \param sample the sample index
+   * \return the fading value in dB
+   */
+  double GetValue (uint32_t rb, uint32_t sample) const
+  {
+    NS_ASSERT_MSG (rb < m_rbNum && sample < m_samplesNum,
+                   "fading sample (" << rb << ", " << sample << ") out of trace");
+    return m_samples[rb * m_stride + sample];
+  }
+
+private:
+  /**
+   * Constructor, use Get () instead.
+   * \param filename the trace file
+   * \param rbNum the number of RBs used
+   * \param samplesNum the number of samples per RB used
+   */
+  LteFadingTrace (std::string filename, uint32_t rbNum, uint32_t samplesNum);
+
+  /**
+   * Map a binary trace.
+   * \return true if the file is a valid binary trace
+   */
+  bool MapBinary (void);
+
+  /**
+   * Parse an ASCII trace.
+   */
+  void LoadAscii (void);
+
+  std::string m_key;            ///< key of the trace in the registry
+  std::string m_filename;       ///< the trace file
+  uint32_t m_rbNum;             ///< number of RBs used
+  uint32_t m_samplesNum;        ///< number of samples per RB used
+  uint32_t m_stride;            ///< number of samples per RB in the file
+  const double *m_samples;      ///< the samples, RB by RB
+  std::vector<double> m_parsed; ///< storage of a parsed ASCII trace
+  void *m_mapping;              ///< the memory-mapped binary file, if any
+  size_t m_mappingSize;         ///< size of m_mapping in bytes
+};
+
+} // namespace ns3
+
+#endif /* LTE_FADING_TRACE_H */
@@ -0,0 +1,201 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011 Centre Tecnologic de Telecomunicacions de Catalunya (CTTC)
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LTE_STATS_FILE_WRITER_H_
+#define LTE_STATS_FILE_WRITER_H_
+
+#include <ns3/simple-ref-count.h>
+#include <ns3/ptr.h>
+#include <ns3/spectrum-value.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <fstream>
+
+namespace ns3 {
+
+/**
+ * \ingroup lte
+ *
+ * Buffered writer of the output files of the ***StatsCalculator classes.
+ *
+ * Each statistics file is opened once, the first time a row is written
+ * to it, and the same writer is then shared by every calculator writing
+ * to that file. Rows are accumulated in a large user-space buffer instead
+ * of reopening the file in append mode on every trace callback. The
+ * buffers of all the writers are flushed when Simulator::Destroy is
+ * called, and a file is closed when the last calculator using it is
+ * destroyed.
+ *
+ * The columns of a file are described by a string listing, separated by
+ * tabs, the name of each column followed by ':' and its type. The types
+ * are f64 (double), i64, u64, u32, u16 and u8 (integers of the given
+ * width) and f64[] (a list of doubles whose length can change from row
+ * to row, only allowed as last column). For instance:
+ *
+ *     "time:f64\tcellId:u16\tIMSI:u64\tInterference:f64[]"
+ *
+ * In TEXT format the column names are written as first line, preceded by
+ * "% ", and each row is written on its own line with tab separated
+ * fields. In BINARY format the file starts with the header
+ *
+ *   - the 8 characters "LTESTATS"
+ *   - uint32_t 0x01020304, to detect the byte order of the file
+ *   - uint32_t format version (currently 1)
+ *   - uint32_t length of the column description, followed by the
+ *     column description itself
+ *
+ * and each row then stores the fields back to back in their native
+ * representation, without padding. A f64[] field is stored as a uint32_t
+ * count followed by that many doubles.
+ */
+class LteStatsFileWriter : public SimpleRefCount<LteStatsFileWriter>
+{
+public:
+  /// Output format of a statistics file
+  enum Format
+  {
+    TEXT,
+    BINARY
+  };
+
+  ~LteStatsFileWriter ();
+
+  /**
+   * Get the writer of a statistics file. If no writer is currently open
+   * for that file, the file is truncated and the header is written.
+   *
+   * \param filename name of the statistics file
+   * \param columns column description
+   * \param format output format, used only when the file is opened
+   * \return the writer, or 0 if the file could not be opened
+   */
+  static Ptr<LteStatsFileWriter> Open (std::string filename, std::string columns,
+                                       Format format);
+
+  /**
+   * \return the name of the file written
+   */
+  std::string GetFilename (void) const;
+
+  /**
+   * \return the output format of the file
+   */
+  Format GetFormat (void) const;
+
+  /**
+   * Write the next field of the current row.
+   * \param value the field value
+   */
+  void Write (double value);
+  /**
+   * \copydoc Write(double)
+   */
+  void Write (int64_t value);
+  /**
+   * \copydoc Write(double)
+   */
+  void Write (uint64_t value);
+  /**
+   * \copydoc Write(double)
+   */
+  void Write (uint32_t value);
+  /**
+   * \copydoc Write(double)
+   */
+  void Write (uint16_t value);
+  /**
+   * \copydoc Write(double)
+   */
+  void Write (uint8_t value);
+  /**
+   * Write a f64[] field with all the values of a SpectrumValue.
+   * \param value the values to write
+   */
+  void Write (const SpectrumValue &value);
+
+  /**
+   * Terminate the current row.
+   */
+  void EndRow (void);
+
+  /**
+   * Flush the buffered rows to the file.
+   */
+  void Flush (void);
+
+  /**
+   * Flush the buffered rows of all the open statistics files.
+   */
+  static void FlushAll (void);
+
+  /**
+   * Set the size of the user-space buffer given to each file opened from
+   * now on.
+   *
+   * \param bytes buffer size in bytes
+   */
+  static void SetBufferSize (uint32_t bytes);
+
+  /**
+   * \return the size of the user-space buffer given to each new file
+   */
+  static uint32_t GetBufferSize (void);
+
+private:
+  /**
+   * Constructor, use Open () instead.
+   * \param filename name of the statistics file
+   * \param format output format
+   */
+  LteStatsFileWriter (std::string filename, Format format);
+
+  /**
+   * Write the header of the file.
+   * \param columns column description
+   */
+  void WriteHeader (std::string columns);
+
+  /**
+   * Start a new field: check its type and, in TEXT format, write the
+   * separator.
+   * \param type the type of the field, as in the column description
+   */
+  void StartField (const char *type);
+
+  /**
+   * Write the native representation of a value in BINARY format.
+   * \param value the value
+   */
+  template <class T>
+  void WriteRaw (T value)
+  {
+    m_stream.write (reinterpret_cast<const char *> (&value), sizeof (T));
+  }
+
+  std::string m_filename;           ///< name of the file
+  Format m_format;                  ///< output format
+  std::vector<std::string> m_types; ///< type of each column
+  uint32_t m_field;                 ///< index of the next field in the row
+  std::vector<char> m_buffer;       ///< user-space buffer, outlives m_stream
+  std::ofstream m_stream;           ///< the output stream
+};
+
+} // namespace ns3
+
+#endif /* LTE_STATS_FILE_WRITER_H_ */
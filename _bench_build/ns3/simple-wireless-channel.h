@@ -0,0 +1,188 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (C) 2015 Massachusetts Institute of Technology
+ * Copyright (c) 2010 University of Washington
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+#ifndef SIMPLE_WIRELESS_CHANNEL_H
+#define SIMPLE_WIRELESS_CHANNEL_H
+
+#include <vector>
+#include "ns3/channel.h"
+#include "ns3/mac48-address.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/enum.h"
+#include "ns3/string.h"
+#include "ns3/nstime.h"
+#include "ns3/event-batch.h"
+#include "ns3/spatial-grid-index.h"
+
+
+
+namespace ns3 {
+
+class SimpleWirelessNetDevice;
+class PropagationLossModel;
+class Packet;
+
+enum ErrorModelType
+{
+  /**
+   * In Constant mode, the packet error rate is constant within the
+   * specified distance range.
+   */
+  CONSTANT,
+  /**
+   * In PER Curve mode, the packet error curves are used to
+   * determine the error rate. The distance is used to look up the
+   * error rate. Note that the range value specified is ignored.
+   * User must build the PER curve by calling addToPERmodel.
+   */
+  PER_CURVE,
+  /**
+   * In Stochastic mode, there are no per packet errors. Instead,
+   * the link to each neighbor is either on or off for randomly
+   * selected durations.
+   */
+  STOCHASTIC
+};
+
+//***************************************************************
+// Define key for stochastic error map key
+//***************************************************************
+class StochasticKey
+{
+public:
+  int srcNodeId;
+  int destNodeId;
+
+  StochasticKey (int k1, int k2)
+    : srcNodeId (k1), destNodeId (k2)
+  {
+  }
+
+  // Ordering is:
+  //   1. lowest source node id
+  //   2. lowest destination node id
+
+  bool operator< (const StochasticKey &right) const
+  {
+    if (srcNodeId == right.srcNodeId)
+      {
+        return(destNodeId < right.destNodeId);
+      }
+    else
+      {
+        return (srcNodeId < right.srcNodeId);
+      }
+  }
+};
+
+struct StochasticLink
+{
+  bool  linkState;   // 1 = ON, 0 = OFF
+  Time  stateExpireTime;
+};
+
+typedef std::map<StochasticKey, StochasticLink> ::iterator  StochasIt;
+
+/**
+ * \ingroup channel
+ * \brief A simple channel, for simple things and testing
+ *
+ * By default Send () visits all the devices of the channel. When the
+ * EnableSpatialIndex attribute is set and the range of the channel is
+ * finite, the positions of the devices are kept in a SpatialGridIndex and
+ * Send () only visits the devices which may be within range of the
+ * sender, in the same order. The devices out of range are then not
+ * passed to the propagation loss model nor to the stochastic error model,
+ * so random loss models and the STOCHASTIC error model draw different
+ * random numbers than without the index.
+ *
+ * With the CopyOnWriteDelivery attribute set (the default), all the
+ * receivers of a transmission share a single copy of the frame, which
+ * they must not modify; a receiver which needs to modify it makes its own
+ * copy. Otherwise each receiver gets its own copy.
+ */
+class SimpleWirelessChannel : public Channel
+{
+public:
+  static TypeId GetTypeId (void);
+  SimpleWirelessChannel ();
+
+  void Send (Ptr<Packet> p, double txPower, uint16_t protocol, Mac48Address to, Mac48Address from,
+             Ptr<SimpleWirelessNetDevice> sender, Time txTime, uint32_t destId);
+
+  void Add (Ptr<SimpleWirelessNetDevice> device);
+
+  /**
+   * \param lossModel the propagation loss model.
+   */
+  void AddPropagationLossModel (Ptr<PropagationLossModel> lossModel);
+
+  // inherited from ns3::Channel
+  virtual std::size_t GetNDevices (void) const;
+  virtual Ptr<NetDevice> GetDevice (std::size_t i) const;
+
+  void setErrorModelType (ErrorModelType type);
+  void setErrorRate (double error);
+  void addToPERmodel (double distance, double error);
+  bool packetInError (double distance);
+  void EnableFixedContention (void);
+  void SetFixedContentionRange (double error);
+  void InitStochasticModel ();
+  bool CheckStochasticError (uint32_t srcId, uint32_t dstId);
+
+protected:
+  virtual void DoDispose (void);
+
+private:
+  /**
+   * Add the devices added since the last call to the spatial index, and
+   * set its cell size.
+   *
+   * \param range the range of the queries (m)
+   */
+  void UpdateSpatialIndex (double range);
+
+  std::vector<Ptr<SimpleWirelessNetDevice> > m_devices;
+  double m_range;
+  double m_errorRate;
+  Ptr<PropagationLossModel> m_lossModel;
+  ErrorModelType m_ErrorModel;
+  Ptr<UniformRandomVariable> m_random;
+  std::map<double, double>  mPERmap;
+
+  bool   m_fixedContentionEnabled;
+  double m_fixedContentionRange;
+  Ptr<ExponentialRandomVariable> m_randomUp;
+  Ptr<ExponentialRandomVariable> m_randomDown;
+
+  Time m_upDuration;
+  Time m_downDuration;
+  std::map<StochasticKey, StochasticLink>   m_StochasticLinks;
+
+  bool m_copyOnWriteDelivery;          //!< whether the receivers share one copy of the frame
+  bool m_spatialIndexEnabled;          //!< whether Send () uses the spatial index
+  SpatialGridIndex m_spatialIndex;     //!< positions of the devices, by device index
+  std::vector<uint32_t> m_candidates;  //!< receivers visited by Send ()
+  EventBatch m_deliveries;             //!< receptions scheduled by Send ()
+
+};
+
+} // namespace ns3
+
+#endif /* SIMPLE_WIRELESS_CHANNEL_H */
@@ -0,0 +1,150 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef SPATIAL_GRID_INDEX_H
+#define SPATIAL_GRID_INDEX_H
+
+#include "ns3/ptr.h"
+#include "ns3/vector.h"
+#include "mobility-model.h"
+#include <stdint.h>
+#include <vector>
+#include <map>
+
+namespace ns3 {
+
+/**
+ * \ingroup mobility
+ * \brief Index of the positions of a set of mobility models on a uniform
+ * grid of square cells, used to find the models close to a point without
+ * visiting all of them.
+ *
+ * Each model added gets an identifier, which is the number of models
+ * added before it. Stationary models are kept in the cell containing
+ * their position, and moved to another cell when their CourseChange
+ * trace source fires. Models with a non-zero velocity keep changing
+ * position without firing CourseChange, so they are not stored in a cell
+ * and are always returned as candidates.
+ *
+ * The grid is two-dimensional (on the x and y coordinates): the
+ * candidates returned for a range include all the models within that
+ * range in three dimensions, and possibly some farther ones, so the
+ * caller still has to check the actual distance.
+ */
+class SpatialGridIndex
+{
+public:
+  SpatialGridIndex ();
+  ~SpatialGridIndex ();
+
+  /**
+   * Set the size of the side of the cells, and rebuild the index. The
+   * cost of GetCandidates () is lowest when the cells are about as large
+   * as the ranges queried.
+   *
+   * \param cellSize the size of the side of the cells (m)
+   */
+  void SetCellSize (double cellSize);
+  /**
+   * \return the size of the side of the cells (m)
+   */
+  double GetCellSize (void) const;
+
+  /**
+   * Add a mobility model to the index.
+   *
+   * \param mobility the mobility model
+   * \return the identifier of the model in the index
+   */
+  uint32_t Add (Ptr<MobilityModel> mobility);
+  /**
+   * \return the number of models added
+   */
+  uint32_t GetN (void) const;
+  /**
+   * \param id the identifier of a model
+   * \return the model
+   */
+  Ptr<MobilityModel> Get (uint32_t id) const;
+  /**
+   * Remove all the models from the index.
+   */
+  void Clear (void);
+
+  /**
+   * Get the models which may be within a range of a position.
+   *
+   * \param position the position
+   * \param range the range (m)
+   * \param candidates the vector to which the identifiers of the candidates
+   *        are appended, in increasing order
+   */
+  void GetCandidates (const Vector &position, double range,
+                      std::vector<uint32_t> &candidates) const;
+
+private:
+  /// Disabled copy constructor, the index is connected to trace sources
+  SpatialGridIndex (const SpatialGridIndex &);
+  /**
+   * Disabled assignment operator
+   * \returns the index
+   */
+  SpatialGridIndex & operator = (const SpatialGridIndex &);
+
+  /// Key of a cell
+  typedef std::pair<int32_t, int32_t> CellKey;
+
+  /**
+   * \param coordinate a coordinate (m)
+   * \return the index of the cell containing it along the same axis
+   */
+  int32_t GetCellCoordinate (double coordinate) const;
+
+  /**
+   * Insert a model in the cell of its current position, or in the list
+   * of moving models.
+   * \param id the identifier of the model
+   */
+  void Insert (uint32_t id);
+  /**
+   * Remove a model from its cell or from the list of moving models.
+   * \param id the identifier of the model
+   */
+  void Remove (uint32_t id);
+
+  /**
+   * Update the position of a model in the index.
+   * \param mobility the model whose course changed
+   */
+  void CourseChanged (Ptr<const MobilityModel> mobility);
+
+  /// A model in the index
+  struct Item
+  {
+    Ptr<MobilityModel> mobility; ///< the model
+    bool moving;                 ///< whether the model is in m_moving
+    CellKey cell;                ///< the cell of the model, if not moving
+  };
+
+  double m_cellSize;                                  ///< size of the cells (m)
+  std::vector<Item> m_items;                          ///< the models, by identifier
+  std::map<CellKey, std::vector<uint32_t> > m_cells;  ///< the models of each non-empty cell
+  std::vector<uint32_t> m_moving;                     ///< the moving models
+  std::map<const MobilityModel *, std::vector<uint32_t> > m_ids; ///< identifiers of each model
+};
+
+} // namespace ns3
+
+#endif /* SPATIAL_GRID_INDEX_H */
@@ -258,6 +258,7 @@ main (int argc, char *argv[])
   Time reportingInterval = Seconds (10);
   uint32_t ftpSize = 2000000000; // 200 MB
   uint16_t port = 4000;  // port number
+  std::string fadingTrace = "src/lte/model/fading-traces/fading_trace_EPA_3kmph.fad";
 
   // change some default attributes so that they are reasonable for
   // this scenario, but do this before processing command line
@@ -276,6 +277,7 @@ main (int argc, char *argv[])
   cmd.AddValue ("verbose", "Enable verbose logging", verbose);
   cmd.AddValue ("hystVal", "Hysteresis Value", hystVal);
   cmd.AddValue ("timeToTrigger", "time to trigger (TTT)", timeToTrigger);
+  cmd.AddValue ("fadingTrace", "Fading trace file", fadingTrace);
 
 
   cmd.Parse (argc, argv);
@@ -331,7 +333,7 @@ main (int argc, char *argv[])
   //lteHelper->SetUeDeviceAttribute ("UlEarfcn", UintegerValue (19950));
   // there are more things we could set in the pathloss model but this is a demo right now.
   lteHelper->SetAttribute ("FadingModel", StringValue ("ns3::TraceFadingLossModel"));
-  lteHelper->SetFadingModelAttribute ("TraceFilename", StringValue ("/home/collin/workspace/ns-3-ee-595-course/src/lte/model/fading-traces/fading_trace_EPA_3kmph.fad"));
+  lteHelper->SetFadingModelAttribute ("TraceFilename", StringValue (fadingTrace));
   lteHelper->SetFadingModelAttribute ("TraceLength", TimeValue (Seconds (10.0)));
   lteHelper->SetFadingModelAttribute ("SamplesNum", UintegerValue (10000));
   lteHelper->SetFadingModelAttribute ("WindowSize", TimeValue (Seconds (0.5)));
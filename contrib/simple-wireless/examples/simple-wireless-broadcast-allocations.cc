@@ -0,0 +1,179 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program counts the heap allocations made to deliver broadcast
+// frames on a SimpleWirelessChannel, with and without the copy-on-write
+// delivery of the channel.
+//
+// All the nodes are within range of each other. Random nodes broadcast a
+// frame with a header and a packet tag, and each receiver reads the
+// header, as the upper layers would. The number of allocations (counted by
+// replacing the global operator new of this program) and the time spent
+// are reported per frame sent.
+//
+// Sample usage:
+//   ./waf --run 'simple-wireless-broadcast-allocations --nodes=50 --frames=2000'
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/seq-ts-header.h"
+#include "ns3/simple-wireless-channel.h"
+#include "ns3/simple-wireless-net-device.h"
+#include "ns3/system-wall-clock-ms.h"
+#include <cstdlib>
+#include <new>
+#include <iostream>
+#include <iomanip>
+
+using namespace ns3;
+
+/// Number of calls to the global operator new
+static uint64_t g_allocations = 0;
+
+void *
+operator new (std::size_t size)
+{
+  ++g_allocations;
+  void *p = std::malloc (size ? size : 1);
+  if (p == 0)
+    {
+      throw std::bad_alloc ();
+    }
+  return p;
+}
+
+void
+operator delete (void *p) noexcept
+{
+  std::free (p);
+}
+
+/// Number of frames received
+static uint64_t g_received = 0;
+
+/**
+ * Receive callback of the devices: read the header of the frame.
+ *
+ * \param device the device
+ * \param packet the frame
+ * \param protocol the protocol number
+ * \param from the source address
+ * \return true
+ */
+static bool
+ReceiveFrame (Ptr<NetDevice> device, Ptr<const Packet> packet, uint16_t protocol, const Address &from)
+{
+  SeqTsHeader header;
+  packet->PeekHeader (header);
+  ++g_received;
+  return true;
+}
+
+/**
+ * Broadcast a frame.
+ *
+ * \param channel the channel
+ * \param sender the sender
+ * \param seq the sequence number of the frame
+ */
+static void
+SendFrame (Ptr<SimpleWirelessChannel> channel, Ptr<SimpleWirelessNetDevice> sender, uint32_t seq)
+{
+  Ptr<Packet> packet = Create<Packet> (500);
+  SeqTsHeader header;
+  header.SetSeq (seq);
+  packet->AddHeader (header);
+  packet->AddPacketTag (DestinationIdTag (NO_DIRECTIONAL_NBR));
+  channel->Send (packet, 1.0, 0x800, Mac48Address::GetBroadcast (),
+                 Mac48Address::ConvertFrom (sender->GetAddress ()), sender,
+                 MicroSeconds (100), NO_DIRECTIONAL_NBR);
+}
+
+/**
+ * Send a number of frames and count the allocations.
+ *
+ * \param nNodes the number of nodes
+ * \param frames the number of frames sent
+ * \param copyOnWrite whether the copy-on-write delivery is enabled
+ */
+static void
+Measure (uint32_t nNodes, uint32_t frames, bool copyOnWrite)
+{
+  RngSeedManager::SetRun (1);
+  NodeContainer nodes;
+  nodes.Create (nNodes);
+  MobilityHelper mobility;
+  mobility.SetPositionAllocator ("ns3::RandomDiscPositionAllocator",
+                                 "Rho", StringValue ("ns3::UniformRandomVariable[Min=0|Max=40]"));
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.Install (nodes);
+
+  Ptr<SimpleWirelessChannel> channel = CreateObject<SimpleWirelessChannel> ();
+  channel->SetAttribute ("MaxRange", DoubleValue (100));
+  channel->SetAttribute ("CopyOnWriteDelivery", BooleanValue (copyOnWrite));
+  std::vector<Ptr<SimpleWirelessNetDevice> > devices;
+  for (uint32_t i = 0; i < nNodes; ++i)
+    {
+      Ptr<SimpleWirelessNetDevice> device = CreateObject<SimpleWirelessNetDevice> ();
+      device->SetChannel (channel);
+      device->SetNode (nodes.Get (i));
+      device->SetAddress (Mac48Address::Allocate ());
+      nodes.Get (i)->AddDevice (device);
+      // after AddDevice, which sets the receive callback to the node
+      device->SetReceiveCallback (MakeCallback (&ReceiveFrame));
+      devices.push_back (device);
+    }
+
+  Ptr<UniformRandomVariable> senders = CreateObject<UniformRandomVariable> ();
+  for (uint32_t i = 0; i < frames; ++i)
+    {
+      Simulator::Schedule (MilliSeconds (i), &SendFrame, channel,
+                           devices[senders->GetInteger (0, nNodes - 1)], i);
+    }
+
+  g_received = 0;
+  uint64_t allocations = g_allocations;
+  SystemWallClockMs clock;
+  clock.Start ();
+  Simulator::Run ();
+  int64_t ms = clock.End ();
+  allocations = g_allocations - allocations;
+  Simulator::Destroy ();
+
+  std::cout << std::setw (14) << (copyOnWrite ? "copy-on-write" : "copy")
+            << std::setw (12) << g_received / frames
+            << std::setw (20) << (double) allocations / frames
+            << std::setw (16) << ms * 1000.0 / frames << std::endl;
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t nNodes = 50;
+  uint32_t frames = 2000;
+
+  CommandLine cmd;
+  cmd.AddValue ("nodes", "Number of nodes", nNodes);
+  cmd.AddValue ("frames", "Number of frames sent", frames);
+  cmd.Parse (argc, argv);
+
+  std::cout << std::setw (14) << "delivery" << std::setw (12) << "rx/frame"
+            << std::setw (20) << "allocations/frame" << std::setw (16) << "time (us/frame)" << std::endl;
+  Measure (nNodes, frames, false);
+  Measure (nNodes, frames, true);
+  return 0;
+}
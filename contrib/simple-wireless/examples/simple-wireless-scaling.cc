@@ -0,0 +1,128 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program measures how the cost of a transmission on a
+// SimpleWirelessChannel scales with the number of nodes, with and without
+// the spatial index of the channel.
+//
+// The nodes are placed uniformly at random on a square whose area grows
+// with the number of nodes, so that the average number of nodes within
+// the transmission range stays the same. For each number of nodes, from
+// minNodes to maxNodes multiplying by 10, random nodes broadcast a packet
+// and the time spent in SimpleWirelessChannel::Send is reported.
+//
+// Sample usage:
+//   ./waf --run 'simple-wireless-scaling --maxNodes=10000 --neighbors=20'
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/simple-wireless-channel.h"
+#include "ns3/simple-wireless-net-device.h"
+#include "ns3/system-wall-clock-ms.h"
+#include <cmath>
+#include <iostream>
+#include <iomanip>
+
+using namespace ns3;
+
+/**
+ * Time the broadcast of a number of packets from random nodes.
+ *
+ * \param nNodes the number of nodes
+ * \param neighbors the average number of nodes within range of a node
+ * \param range the transmission range (m)
+ * \param packets the number of packets sent
+ * \param index whether the spatial index of the channel is enabled
+ * \return the elapsed time in ms
+ */
+static int64_t
+Measure (uint32_t nNodes, double neighbors, double range, uint32_t packets, bool index)
+{
+  RngSeedManager::SetRun (1);
+  double side = std::sqrt (nNodes * M_PI * range * range / neighbors);
+
+  NodeContainer nodes;
+  nodes.Create (nNodes);
+  MobilityHelper mobility;
+  std::ostringstream sideString;
+  sideString << "ns3::UniformRandomVariable[Min=0.0|Max=" << side << "]";
+  mobility.SetPositionAllocator ("ns3::RandomRectanglePositionAllocator",
+                                 "X", StringValue (sideString.str ()),
+                                 "Y", StringValue (sideString.str ()));
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.Install (nodes);
+
+  Ptr<SimpleWirelessChannel> channel = CreateObject<SimpleWirelessChannel> ();
+  channel->SetAttribute ("MaxRange", DoubleValue (range));
+  channel->SetAttribute ("EnableSpatialIndex", BooleanValue (index));
+  std::vector<Ptr<SimpleWirelessNetDevice> > devices;
+  for (uint32_t i = 0; i < nNodes; ++i)
+    {
+      Ptr<SimpleWirelessNetDevice> device = CreateObject<SimpleWirelessNetDevice> ();
+      device->SetChannel (channel);
+      device->SetNode (nodes.Get (i));
+      device->SetAddress (Mac48Address::Allocate ());
+      nodes.Get (i)->AddDevice (device);
+      devices.push_back (device);
+    }
+
+  Ptr<UniformRandomVariable> senders = CreateObject<UniformRandomVariable> ();
+  Ptr<Packet> packet = Create<Packet> (100);
+  SystemWallClockMs clock;
+  clock.Start ();
+  for (uint32_t i = 0; i < packets; ++i)
+    {
+      Ptr<SimpleWirelessNetDevice> sender = devices[senders->GetInteger (0, nNodes - 1)];
+      channel->Send (packet, 1.0, 0x800, Mac48Address::GetBroadcast (),
+                     Mac48Address::ConvertFrom (sender->GetAddress ()), sender,
+                     MicroSeconds (100), NO_DIRECTIONAL_NBR);
+    }
+  int64_t ms = clock.End ();
+  // the receptions scheduled are the same in both cases, drop them
+  Simulator::Destroy ();
+  return ms;
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t minNodes = 10;
+  uint32_t maxNodes = 10000;
+  double neighbors = 20;
+  double range = 100;
+  uint32_t packets = 10000;
+
+  CommandLine cmd;
+  cmd.AddValue ("minNodes", "Smallest number of nodes", minNodes);
+  cmd.AddValue ("maxNodes", "Largest number of nodes", maxNodes);
+  cmd.AddValue ("neighbors", "Average number of nodes within range of a node", neighbors);
+  cmd.AddValue ("range", "Transmission range (m)", range);
+  cmd.AddValue ("packets", "Number of packets sent for each number of nodes", packets);
+  cmd.Parse (argc, argv);
+
+  std::cout << std::setw (8) << "nodes" << std::setw (16) << "scan (us/tx)"
+            << std::setw (16) << "index (us/tx)" << std::endl;
+  for (uint32_t n = minNodes; n <= maxNodes; n *= 10)
+    {
+      int64_t scanMs = Measure (n, neighbors, range, packets, false);
+      int64_t indexMs = Measure (n, neighbors, range, packets, true);
+      std::cout << std::setw (8) << n
+                << std::setw (16) << scanMs * 1000.0 / packets
+                << std::setw (16) << indexMs * 1000.0 / packets << std::endl;
+    }
+  return 0;
+}
@@ -0,0 +1,260 @@
+#!/usr/bin/env python
+#
+# This program is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License version 2 as
+# published by the Free Software Foundation;
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; if not, write to the Free Software
+# Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+#
+
+# This program runs a parameter sweep of the lte-tcp-x2-handover example,
+# with the trials running in parallel.
+#
+# The trial grid is speed x hysteresis x time-to-trigger x run. Each trial
+# runs the example program directly (not through './waf --run', which
+# serializes the runs on the lock of the build) in its own directory
+#
+#   results/<sweep>/lte-tcp-x2-handover-<speed>-<hyst>-<ttt>-<run>/
+#
+# so the trace files of the trials do not overwrite each other, with its
+# own RngRun equal to the run number. The standard output of the program
+# is kept in 'stdout.txt' in the same directory.
+#
+# When all the trials are done, the results of each trial (number of
+# handovers, TCP bytes received and mean TCP throughput) are written to
+# 'trials.dat' in the sweep directory, and their mean and standard
+# deviation over the runs of each (speed, hyst, ttt) point to
+# 'summary.dat'.
+#
+# The program must be built first, e.g. with './waf build'. Sample usage,
+# from this directory:
+#
+#   ./run-lte-tcp-x2-handover-sweep.py --speed=20,275 --hyst=1,3 \
+#       --ttt=64,256 --runs=1-25 --jobs=32
+
+from __future__ import print_function
+
+import argparse
+import glob
+import math
+import multiprocessing
+import os
+import re
+import subprocess
+import sys
+import time
+
+PROGRAM = 'lte-tcp-x2-handover'
+EXPERIMENT_DIR = os.path.dirname(os.path.abspath(__file__))
+TOP_DIR = os.path.abspath(os.path.join(EXPERIMENT_DIR, '..', '..', '..', '..'))
+
+
+def parse_list(text, convert=int):
+    """Parse a comma-separated list of values, with ranges like '1-10'."""
+    values = []
+    for item in text.split(','):
+        item = item.strip()
+        if not item:
+            continue
+        if convert is int and '-' in item[1:]:
+            first, last = item.split('-', 1)
+            values.extend(range(int(first), int(last) + 1))
+        else:
+            values.append(convert(item))
+    return values
+
+
+def find_build_dir():
+    """Return the build directory of the last 'waf configure'."""
+    for lock in glob.glob(os.path.join(TOP_DIR, '.lock-waf_*_build')):
+        with open(lock) as f:
+            for line in f:
+                match = re.match(r"out_dir\s*=\s*'(.*)'", line)
+                if match:
+                    return match.group(1)
+    return os.path.join(TOP_DIR, 'build')
+
+
+def find_program(build_dir):
+    """Return the path of the program in the build directory."""
+    pattern = os.path.join(build_dir, 'contrib', 'simple-wireless', 'examples',
+                           'ns*-' + PROGRAM + '-*')
+    candidates = [p for p in glob.glob(pattern) if os.access(p, os.X_OK)]
+    if not candidates:
+        return None
+    # prefer the most recently built profile
+    return max(candidates, key=os.path.getmtime)
+
+
+def run_trial(trial):
+    """Run one trial in its own directory; return its results."""
+    program, lib_dir, directory, args, point = trial
+    if not os.path.isdir(directory):
+        os.makedirs(directory)
+    env = dict(os.environ)
+    env['LD_LIBRARY_PATH'] = lib_dir + os.pathsep + env.get('LD_LIBRARY_PATH', '')
+    start = time.time()
+    with open(os.path.join(directory, 'stdout.txt'), 'w') as out:
+        status = subprocess.call([program] + args, cwd=directory, env=env,
+                                 stdout=out, stderr=subprocess.STDOUT)
+    elapsed = time.time() - start
+    handovers, rx_bytes, throughput = collect_results(directory)
+    return point, status, elapsed, handovers, rx_bytes, throughput
+
+
+def collect_results(directory):
+    """Extract the results of a trial from its output files."""
+    handovers = 0
+    try:
+        with open(os.path.join(directory, 'stdout.txt')) as f:
+            for line in f:
+                if 'UE IMSI' in line and 'successful handover' in line:
+                    handovers += 1
+    except IOError:
+        pass
+    rx_bytes = 0
+    first = None
+    last = None
+    try:
+        with open(os.path.join(directory, PROGRAM + '.tcp-receive.dat')) as f:
+            for line in f:
+                if line.startswith('#'):
+                    continue
+                fields = line.split()
+                if len(fields) < 2:
+                    continue
+                t = float(fields[0])
+                if first is None:
+                    first = t
+                last = t
+                rx_bytes += int(fields[1])
+    except IOError:
+        pass
+    throughput = 0.0
+    if first is not None and last > first:
+        throughput = rx_bytes * 8 / (last - first) / 1e6
+    return handovers, rx_bytes, throughput
+
+
+def mean_std(values):
+    """Return the mean and the sample standard deviation of values."""
+    if not values:
+        return float('nan'), float('nan')
+    mean = sum(values) / float(len(values))
+    if len(values) < 2:
+        return mean, 0.0
+    var = sum((v - mean) ** 2 for v in values) / (len(values) - 1)
+    return mean, math.sqrt(var)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Run a parallel sweep of ' + PROGRAM)
+    parser.add_argument('--speed', default='275', help='UE speeds (m/s), comma-separated')
+    parser.add_argument('--hyst', default='3', help='hysteresis values (dB), comma-separated')
+    parser.add_argument('--ttt', default='256', help='time-to-trigger values (ms), comma-separated')
+    parser.add_argument('--runs', default='1-100', help='RngRun values, e.g. 1-100 or 1,5,9')
+    parser.add_argument('--jobs', type=int, default=multiprocessing.cpu_count(),
+                        help='number of trials run in parallel (default: number of cores)')
+    parser.add_argument('--x2Distance', default='500', help='distance between the eNBs (m)')
+    parser.add_argument('--yDistanceForUe', default='1000', help='y coordinate of the UE (m)')
+    parser.add_argument('--useRlcUm', default='0', help='use RLC UM instead of RLC AM')
+    parser.add_argument('--handoverType', default='A3Rsrp', help='A2A4 or A3Rsrp')
+    parser.add_argument('--fading-trace', help='fading trace file (default: the EPA 3 kmph '
+                        'trace of src/lte/model/fading-traces)')
+    parser.add_argument('--build-dir', help='build directory (default: the configured one)')
+    parser.add_argument('--name', default=None,
+                        help='name of the sweep directory (default: timestamped)')
+    args = parser.parse_args()
+
+    build_dir = args.build_dir or find_build_dir()
+    program = find_program(build_dir)
+    if program is None:
+        print('cannot find the %s program in %s; build it first with ./waf build'
+              % (PROGRAM, build_dir), file=sys.stderr)
+        return 1
+
+    # the trials do not run from the top directory
+    fading_trace = os.path.abspath(args.fading_trace or
+                                   os.path.join(TOP_DIR, 'src', 'lte', 'model', 'fading-traces',
+                                                'fading_trace_EPA_3kmph.fad'))
+
+    name = args.name or PROGRAM + '-' + time.strftime('%Y%m%d-%H%M%S')
+    sweep_dir = os.path.join(EXPERIMENT_DIR, 'results', name)
+    trials = []
+    for speed in parse_list(args.speed, float):
+        for hyst in parse_list(args.hyst, float):
+            for ttt in parse_list(args.ttt):
+                for run in parse_list(args.runs):
+                    point = ('%g' % speed, '%g' % hyst, ttt, run)
+                    directory = os.path.join(sweep_dir, '%s-%s-%s-%d-%d' % ((PROGRAM,) + point))
+                    trial_args = ['--RngRun=%d' % run,
+                                  '--speed=%g' % speed,
+                                  '--x2Distance=' + args.x2Distance,
+                                  '--yDistanceForUe=' + args.yDistanceForUe,
+                                  '--useRlcUm=' + args.useRlcUm,
+                                  '--handoverType=' + args.handoverType,
+                                  '--hystVal=%g' % hyst,
+                                  '--timeToTrigger=%d' % ttt,
+                                  '--fadingTrace=' + fading_trace]
+                    trials.append((program, os.path.join(build_dir, 'lib'), directory,
+                                   trial_args, point))
+
+    print('running %d trials of %s, %d at a time, in %s'
+          % (len(trials), program, args.jobs, sweep_dir))
+    if not os.path.isdir(sweep_dir):
+        os.makedirs(sweep_dir)
+    results = []
+    failed = 0
+    start = time.time()
+    pool = multiprocessing.Pool(max(1, args.jobs))
+    try:
+        for result in pool.imap_unordered(run_trial, trials):
+            results.append(result)
+            point, status = result[0], result[1]
+            if status != 0:
+                failed += 1
+            print('[%d/%d] speed %s hyst %s ttt %d run %d: %s (%.1f s)'
+                  % ((len(results), len(trials)) + point
+                     + ('ok' if status == 0 else 'failed with status %d' % status,
+                        result[2])))
+        pool.close()
+    except KeyboardInterrupt:
+        pool.terminate()
+        print('interrupted', file=sys.stderr)
+        return 1
+    pool.join()
+
+    results.sort()
+    with open(os.path.join(sweep_dir, 'trials.dat'), 'w') as f:
+        f.write('# speed hyst ttt run status elapsed(s) handovers rxBytes throughput(Mb/s)\n')
+        for point, status, elapsed, handovers, rx_bytes, throughput in results:
+            f.write('%s %s %d %d %d %.1f %d %d %.4f\n'
+                    % (point + (status, elapsed, handovers, rx_bytes, throughput)))
+
+    groups = {}
+    for point, status, elapsed, handovers, rx_bytes, throughput in results:
+        if status == 0:
+            groups.setdefault(point[:3], []).append((handovers, throughput))
+    with open(os.path.join(sweep_dir, 'summary.dat'), 'w') as f:
+        f.write('# speed hyst ttt trials handovers(mean std) throughput(Mb/s)(mean std)\n')
+        for key in sorted(groups):
+            values = groups[key]
+            ho_mean, ho_std = mean_std([v[0] for v in values])
+            tp_mean, tp_std = mean_std([v[1] for v in values])
+            f.write('%s %s %d %d %.3f %.3f %.4f %.4f\n'
+                    % (key + (len(values), ho_mean, ho_std, tp_mean, tp_std)))
+
+    print('%d trials done in %.1f s, %d failed; results in %s'
+          % (len(results), time.time() - start, failed, sweep_dir))
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -22,6 +22,9 @@
 # 
 # Results and all traces are stored in a timestamped 'results' directory,
 # as well as the PDFs generated.
+#
+# The trials run one after the other; run-lte-tcp-x2-handover-sweep.py
+# runs the same sweep with the trials in parallel.
 
 set -e
 set -o errexit
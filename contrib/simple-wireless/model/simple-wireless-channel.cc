@@ -23,12 +23,15 @@
 #include "ns3/log.h"
 #include "ns3/double.h"
 #include "ns3/uinteger.h"
+#include "ns3/boolean.h"
 #include "ns3/ptr.h"
 #include "ns3/mobility-model.h"
 #include "ns3/propagation-loss-model.h"
 #include "simple-wireless-channel.h"
 #include "simple-wireless-net-device.h"
 #include <iomanip>
+#include <algorithm>
+#include <limits>
 
 NS_LOG_COMPONENT_DEFINE ("SimpleWirelessChannel");
 
@@ -79,6 +82,18 @@ SimpleWirelessChannel::GetTypeId (void)
                    TimeValue (MicroSeconds (100.0)),
                    MakeTimeAccessor (&SimpleWirelessChannel::m_downDuration),
                    MakeTimeChecker ())
+    .AddAttribute ("CopyOnWriteDelivery",
+                   "Deliver a single copy of each frame, shared by all the receivers, "
+                   "instead of a copy for each receiver.",
+                   BooleanValue (true),
+                   MakeBooleanAccessor (&SimpleWirelessChannel::m_copyOnWriteDelivery),
+                   MakeBooleanChecker ())
+    .AddAttribute ("EnableSpatialIndex",
+                   "Only visit the devices which may be within range of the sender, "
+                   "using a grid index of their positions. Has no effect if the range is not set.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&SimpleWirelessChannel::m_spatialIndexEnabled),
+                   MakeBooleanChecker ())
   ;
   return tid;
 }
@@ -91,6 +106,32 @@ SimpleWirelessChannel::SimpleWirelessChannel ()
   m_errorRate = 0.0;
   m_fixedContentionEnabled = false;
   m_fixedContentionRange = 0;
+  m_copyOnWriteDelivery = true;
+  m_spatialIndexEnabled = false;
+}
+
+void
+SimpleWirelessChannel::DoDispose (void)
+{
+  m_spatialIndex.Clear ();
+  m_candidates.clear ();
+  Channel::DoDispose ();
+}
+
+void
+SimpleWirelessChannel::UpdateSpatialIndex (double range)
+{
+  for (uint32_t i = m_spatialIndex.GetN (); i < m_devices.size (); ++i)
+    {
+      Ptr<MobilityModel> mobility = m_devices[i]->GetNode ()->GetObject<MobilityModel> ();
+      NS_ASSERT_MSG (mobility, "Error:  nodes must have mobility models");
+      m_spatialIndex.Add (mobility);
+    }
+  if (m_spatialIndex.GetCellSize () != range)
+    {
+      NS_LOG_DEBUG ("Spatial index cell size set to " << range);
+      m_spatialIndex.SetCellSize (range);
+    }
 }
 
 void
@@ -117,9 +158,36 @@ SimpleWirelessChannel::Send (Ptr<Packet> p, double txPower, uint16_t protocol,
         }
     }
 
-  for (std::vector<Ptr<SimpleWirelessNetDevice> >::const_iterator i = m_devices.begin (); i != m_devices.end (); ++i)
+  Ptr<MobilityModel> a = sender->GetNode ()->GetObject<MobilityModel> ();
+
+  // Nodes farther than the range, or than the contention range, are not
+  // affected by the transmission: the spatial index, if enabled, gives
+  // the devices which may be closer, in increasing order of index.
+  double range = m_range;
+  if (m_fixedContentionEnabled)
     {
-      Ptr<SimpleWirelessNetDevice> tmp = *i;
+      range = std::max (range, m_fixedContentionRange);
+    }
+  bool useIndex = m_spatialIndexEnabled && range < std::numeric_limits<double>::max ();
+  std::size_t nCandidates = m_devices.size ();
+  if (useIndex)
+    {
+      NS_ASSERT_MSG (a, "Error:  nodes must have mobility models");
+      UpdateSpatialIndex (range);
+      m_candidates.clear ();
+      m_spatialIndex.GetCandidates (a->GetPosition (), range, m_candidates);
+      nCandidates = m_candidates.size ();
+    }
+
+  // The sender may modify its packet after the transmission, so the
+  // receivers get a copy of it: a single one shared by all of them, made
+  // on the first reception, or one each.
+  Ptr<const Packet> frame;
+
+  for (std::size_t i = 0; i < nCandidates; ++i)
+    {
+      uint32_t index = useIndex ? m_candidates[i] : i;
+      Ptr<SimpleWirelessNetDevice> tmp = m_devices[index];
       uint32_t destNodeId = tmp->GetNode ()->GetId ();
 
       // don't send to ourselves
@@ -144,8 +212,7 @@ SimpleWirelessChannel::Send (Ptr<Packet> p, double txPower, uint16_t protocol,
           continue;
         }
 
-      Ptr<MobilityModel> a = sender->GetNode ()->GetObject<MobilityModel> ();
-      Ptr<MobilityModel> b = tmp->GetNode ()->GetObject<MobilityModel> ();
+      Ptr<MobilityModel> b = useIndex ? m_spatialIndex.Get (index) : tmp->GetNode ()->GetObject<MobilityModel> ();
       NS_ASSERT_MSG (a && b, "Error:  nodes must have mobility models");
 
       // Get distance and determine error rate based on that
@@ -185,10 +252,15 @@ SimpleWirelessChannel::Send (Ptr<Packet> p, double txPower, uint16_t protocol,
                            << " at distance " << distance << " meters; time (ns): " << Simulator::Now ().GetNanoSeconds ()
                            << " txDelay: " << txTime << "  propDelay: " << propDelay);
 
-      Simulator::ScheduleWithContext (destNodeId, NanoSeconds (txTime + propDelay),
-                                      &SimpleWirelessNetDevice::Receive, tmp, p->Copy (), rxPower, protocol, to, from);
+      if (!m_copyOnWriteDelivery || !frame)
+        {
+          frame = p->Copy ();
+        }
+      m_deliveries.Add (destNodeId, NanoSeconds (txTime + propDelay),
+                        &SimpleWirelessNetDevice::Receive, tmp, frame, rxPower, protocol, to, from);
 
     }
+  Simulator::ScheduleBatch (m_deliveries);
 }
 
 void
@@ -26,6 +26,9 @@
 #include "ns3/random-variable-stream.h"
 #include "ns3/enum.h"
 #include "ns3/string.h"
+#include "ns3/nstime.h"
+#include "ns3/event-batch.h"
+#include "ns3/spatial-grid-index.h"
 
 
 
@@ -99,6 +102,20 @@ typedef std::map<StochasticKey, StochasticLink> ::iterator  StochasIt;
 /**
  * \ingroup channel
  * \brief A simple channel, for simple things and testing
+ *
+ * By default Send () visits all the devices of the channel. When the
+ * EnableSpatialIndex attribute is set and the range of the channel is
+ * finite, the positions of the devices are kept in a SpatialGridIndex and
+ * Send () only visits the devices which may be within range of the
+ * sender, in the same order. The devices out of range are then not
+ * passed to the propagation loss model nor to the stochastic error model,
+ * so random loss models and the STOCHASTIC error model draw different
+ * random numbers than without the index.
+ *
+ * With the CopyOnWriteDelivery attribute set (the default), all the
+ * receivers of a transmission share a single copy of the frame, which
+ * they must not modify; a receiver which needs to modify it makes its own
+ * copy. Otherwise each receiver gets its own copy.
  */
 class SimpleWirelessChannel : public Channel
 {
@@ -129,7 +146,18 @@ public:
   void InitStochasticModel ();
   bool CheckStochasticError (uint32_t srcId, uint32_t dstId);
 
+protected:
+  virtual void DoDispose (void);
+
 private:
+  /**
+   * Add the devices added since the last call to the spatial index, and
+   * set its cell size.
+   *
+   * \param range the range of the queries (m)
+   */
+  void UpdateSpatialIndex (double range);
+
   std::vector<Ptr<SimpleWirelessNetDevice> > m_devices;
   double m_range;
   double m_errorRate;
@@ -147,6 +175,12 @@ private:
   Time m_downDuration;
   std::map<StochasticKey, StochasticLink>   m_StochasticLinks;
 
+  bool m_copyOnWriteDelivery;          //!< whether the receivers share one copy of the frame
+  bool m_spatialIndexEnabled;          //!< whether Send () uses the spatial index
+  SpatialGridIndex m_spatialIndex;     //!< positions of the devices, by device index
+  std::vector<uint32_t> m_candidates;  //!< receivers visited by Send ()
+  EventBatch m_deliveries;             //!< receptions scheduled by Send ()
+
 };
 
 } // namespace ns3
@@ -272,7 +272,7 @@ SimpleWirelessNetDevice::DoInitialize (void)
 }
 
 void
-SimpleWirelessNetDevice::Receive (Ptr<Packet> packet, double rxPower, uint16_t protocol,
+SimpleWirelessNetDevice::Receive (Ptr<const Packet> packet, double rxPower, uint16_t protocol,
                                   Mac48Address to, Mac48Address from)
 {
   NS_LOG_FUNCTION (packet << rxPower << protocol << to << from);
@@ -320,18 +320,27 @@ SimpleWirelessNetDevice::HandleReceive (void)
 }
 
 void
-SimpleWirelessNetDevice::DoReceive (Ptr<Packet> packet, double rxPower, uint16_t protocol,
+SimpleWirelessNetDevice::DoReceive (Ptr<const Packet> packet, double rxPower, uint16_t protocol,
                                   Mac48Address to, Mac48Address from)
 {
   NS_LOG_FUNCTION (packet << rxPower << protocol << to << from);
   NetDevice::PacketType packetType;
+
+  // The frame may be shared with the other receivers; the error model
+  // takes a modifiable packet, so give it a private copy.
+  Ptr<Packet> copy;
+  if (m_receiveErrorModel)
+    {
+      copy = packet->Copy ();
+      packet = copy;
+    }
   
   m_phyRxBeginTrace (packet, rxPower, from);
   m_pktRcvTotal++;
 
   NS_LOG_INFO ("Node " << this->GetNode ()->GetId () << " receiving packet " << packet->GetUid () << "  from " << from << "  to " << to  );
 
-  if (m_receiveErrorModel && m_receiveErrorModel->IsCorrupt (packet) )
+  if (m_receiveErrorModel && m_receiveErrorModel->IsCorrupt (copy) )
     {
       m_phyRxDropTrace (packet, rxPower, from);
       m_pktRcvDrop++;
@@ -395,7 +404,7 @@ SimpleWirelessNetDevice::DoReceive (Ptr<Packet> packet, double rxPower, uint16_t
 
   // Notionally, the below is MAC level processing for the rest of this method
 
-  if (m_receiveErrorModel && m_receiveErrorModel->IsCorrupt (packet) )
+  if (m_receiveErrorModel && m_receiveErrorModel->IsCorrupt (copy) )
     {
       m_macRxDropTrace (packet);
       m_pktRcvDrop++;
@@ -123,7 +123,21 @@ public:
   static TypeId GetTypeId (void);
   SimpleWirelessNetDevice ();
 
-  void Receive (Ptr<Packet> packet, double rxPower, uint16_t protocol, Mac48Address to, Mac48Address from);
+  /**
+   * Receive a frame from the channel.
+   *
+   * The frame may be shared with the other receivers of the same
+   * transmission (see the CopyOnWriteDelivery attribute of
+   * SimpleWirelessChannel), so it must not be modified: it is copied
+   * before being passed to the receive error model.
+   *
+   * \param packet the frame
+   * \param rxPower the receive power
+   * \param protocol the protocol number
+   * \param to the destination address
+   * \param from the source address
+   */
+  void Receive (Ptr<const Packet> packet, double rxPower, uint16_t protocol, Mac48Address to, Mac48Address from);
   void SetChannel (Ptr<SimpleWirelessChannel> channel);
 
   /**
@@ -314,7 +328,7 @@ private:
   void HandleStartOfFrame (void);
 
   struct ReceivedPacket {
-    Ptr<Packet> packet {0};
+    Ptr<const Packet> packet {0};
     // A receive power of zero dBm is not zero power, but 1 mW
     // Need to initialize to the smallest possible negative number
     double rxPower {-std::numeric_limits<double>::max ()};
@@ -326,7 +340,7 @@ private:
   /**
    * For modeling receiver processing delay
    */
-  void DoReceive (Ptr<Packet> packet, double rxPower, uint16_t protocol, Mac48Address to, Mac48Address from);
+  void DoReceive (Ptr<const Packet> packet, double rxPower, uint16_t protocol, Mac48Address to, Mac48Address from);
 
   /**
    * In slotted aloha, handle the received frames.
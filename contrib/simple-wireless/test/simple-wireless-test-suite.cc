@@ -19,6 +19,14 @@
 
 #include "ns3/test.h"
 #include "ns3/snr-per-error-model.h"
+#include "ns3/simple-wireless-channel.h"
+#include "ns3/simple-wireless-net-device.h"
+#include "ns3/constant-position-mobility-model.h"
+#include "ns3/constant-velocity-mobility-model.h"
+#include "ns3/node.h"
+#include "ns3/simulator.h"
+#include "ns3/boolean.h"
+#include "ns3/double.h"
 
 using namespace ns3;
 
@@ -138,6 +146,127 @@ SimpleWirelessTableModel::DoRun (void)
   NS_TEST_ASSERT_MSG_EQ_TOL (valueToCheck, 1, 1e-6, "Numbers are not equal within tolerance");
 }
 
+class SimpleWirelessSpatialIndex : public TestCase
+{
+public:
+  SimpleWirelessSpatialIndex ();
+  virtual ~SimpleWirelessSpatialIndex ();
+
+private:
+  virtual void DoRun (void);
+  // Run a scenario and return the receptions, as "time receiver sender"
+  std::vector<std::string> RunScenario (bool index);
+  void PhyRxBegin (uint32_t receiver, Ptr<const Packet> p, double rxPower, Mac48Address from);
+  bool ReceiveFromDevice (Ptr<NetDevice> device, Ptr<const Packet> p, uint16_t protocol, const Address &from);
+  void SendFrom (Ptr<SimpleWirelessChannel> channel, Ptr<SimpleWirelessNetDevice> sender);
+
+  std::vector<std::string> m_receptions;
+  std::map<Mac48Address, uint32_t> m_senders; // index of the device of each address
+};
+
+SimpleWirelessSpatialIndex::SimpleWirelessSpatialIndex ()
+  : TestCase ("Check that the spatial index of the channel does not change the receivers")
+{
+}
+
+SimpleWirelessSpatialIndex::~SimpleWirelessSpatialIndex ()
+{
+}
+
+void
+SimpleWirelessSpatialIndex::PhyRxBegin (uint32_t receiver, Ptr<const Packet> p, double rxPower, Mac48Address from)
+{
+  std::ostringstream reception;
+  reception << Simulator::Now ().GetNanoSeconds () << " " << receiver << " " << m_senders[from];
+  m_receptions.push_back (reception.str ());
+}
+
+bool
+SimpleWirelessSpatialIndex::ReceiveFromDevice (Ptr<NetDevice> device, Ptr<const Packet> p, uint16_t protocol, const Address &from)
+{
+  return true;
+}
+
+void
+SimpleWirelessSpatialIndex::SendFrom (Ptr<SimpleWirelessChannel> channel, Ptr<SimpleWirelessNetDevice> sender)
+{
+  channel->Send (Create<Packet> (100), 1.0, 0x800, Mac48Address::GetBroadcast (),
+                 Mac48Address::ConvertFrom (sender->GetAddress ()), sender,
+                 MicroSeconds (100), NO_DIRECTIONAL_NBR);
+}
+
+std::vector<std::string>
+SimpleWirelessSpatialIndex::RunScenario (bool index)
+{
+  m_receptions.clear ();
+  m_senders.clear ();
+  Ptr<UniformRandomVariable> random = CreateObject<UniformRandomVariable> ();
+  random->SetStream (1);
+  Ptr<SimpleWirelessChannel> channel = CreateObject<SimpleWirelessChannel> ();
+  channel->SetAttribute ("MaxRange", DoubleValue (100));
+  channel->SetAttribute ("EnableSpatialIndex", BooleanValue (index));
+
+  std::vector<Ptr<SimpleWirelessNetDevice> > devices;
+  std::vector<Ptr<MobilityModel> > mobilities;
+  for (uint32_t i = 0; i < 60; ++i)
+    {
+      Ptr<Node> node = CreateObject<Node> ();
+      Ptr<MobilityModel> mobility;
+      if (i % 10 == 0)
+        {
+          Ptr<ConstantVelocityMobilityModel> moving = CreateObject<ConstantVelocityMobilityModel> ();
+          moving->SetVelocity (Vector (random->GetValue (-20, 20), random->GetValue (-20, 20), 0));
+          mobility = moving;
+        }
+      else
+        {
+          mobility = CreateObject<ConstantPositionMobilityModel> ();
+        }
+      mobility->SetPosition (Vector (random->GetValue (0, 500), random->GetValue (0, 500), 0));
+      node->AggregateObject (mobility);
+      Ptr<SimpleWirelessNetDevice> device = CreateObject<SimpleWirelessNetDevice> ();
+      device->SetChannel (channel);
+      device->SetNode (node);
+      Mac48Address address = Mac48Address::Allocate ();
+      device->SetAddress (address);
+      m_senders[address] = i;
+      device->SetReceiveCallback (MakeCallback (&SimpleWirelessSpatialIndex::ReceiveFromDevice, this));
+      device->TraceConnectWithoutContext ("PhyRxBegin", MakeCallback (&SimpleWirelessSpatialIndex::PhyRxBegin, this).Bind (i));
+      node->AddDevice (device);
+      devices.push_back (device);
+      mobilities.push_back (mobility);
+    }
+
+  for (uint32_t i = 0; i < 200; ++i)
+    {
+      Time at = MilliSeconds (10 * i);
+      Simulator::Schedule (at, &SimpleWirelessSpatialIndex::SendFrom, this, channel,
+                           devices[random->GetInteger (0, devices.size () - 1)]);
+      if (i % 20 == 0)
+        {
+          // move a stationary node
+          Simulator::Schedule (at, &MobilityModel::SetPosition, mobilities[1 + i % 9],
+                               Vector (random->GetValue (0, 500), random->GetValue (0, 500), 0));
+        }
+    }
+  Simulator::Run ();
+  Simulator::Destroy ();
+  return m_receptions;
+}
+
+void
+SimpleWirelessSpatialIndex::DoRun (void)
+{
+  std::vector<std::string> scan = RunScenario (false);
+  std::vector<std::string> index = RunScenario (true);
+  NS_TEST_ASSERT_MSG_GT (scan.size (), 200, "too few receptions to compare");
+  NS_TEST_ASSERT_MSG_EQ (index.size (), scan.size (), "different number of receptions");
+  for (uint32_t i = 0; i < scan.size (); ++i)
+    {
+      NS_TEST_ASSERT_MSG_EQ (index[i], scan[i], "different reception " << i);
+    }
+}
+
 class SimpleWirelessTestSuite : public TestSuite
 {
 public:
@@ -149,6 +278,7 @@ SimpleWirelessTestSuite::SimpleWirelessTestSuite ()
 {
   AddTestCase (new SimpleWirelessSnrPerMethods, TestCase::QUICK);
   AddTestCase (new SimpleWirelessTableModel, TestCase::QUICK);
+  AddTestCase (new SimpleWirelessSpatialIndex, TestCase::QUICK);
 }
 
 static SimpleWirelessTestSuite simpleWirelessTestSuite;
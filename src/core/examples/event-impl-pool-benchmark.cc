@@ -0,0 +1,176 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program measures the number of events executed per second with
+// and without the recycling of the memory of the events (the
+// EventImplPool global value).
+//
+// The workload mimics the periodic events of a cellular simulation:
+// each of a number of terminals has a subframe event every millisecond,
+// which schedules a short processing event and, every few subframes, a
+// measurement report carrying a few arguments. Each run is made with
+// the pool disabled, then enabled.
+//
+// Sample usage:
+//   ./waf --run 'event-impl-pool-benchmark --terminals=200 --duration=20'
+
+#include "ns3/core-module.h"
+#include "ns3/system-wall-clock-ms.h"
+#include <iostream>
+#include <iomanip>
+
+using namespace ns3;
+
+/**
+ * A terminal scheduling the events of each of its subframes.
+ */
+class Terminal
+{
+public:
+  /**
+   * Constructor.
+   * \param id the identifier of the terminal
+   */
+  Terminal (uint16_t id);
+
+  /** Schedule the first subframe. */
+  void Start (void);
+  /** \returns the number of events executed. */
+  uint64_t GetEvents (void) const;
+
+private:
+  /** The start of a subframe. */
+  void Subframe (void);
+  /** The end of the processing of a subframe. */
+  void Process (void);
+  /**
+   * A measurement report.
+   * \param id the identifier of the terminal
+   * \param rsrp the measured power
+   * \param rsrq the measured quality
+   */
+  void Report (uint16_t id, double rsrp, double rsrq);
+
+  uint16_t m_id;     //!< The identifier of the terminal.
+  uint32_t m_frame;  //!< The number of subframes.
+  uint64_t m_events; //!< The number of events executed.
+};
+
+Terminal::Terminal (uint16_t id)
+  : m_id (id),
+    m_frame (0),
+    m_events (0)
+{
+}
+
+void
+Terminal::Start (void)
+{
+  Simulator::Schedule (MicroSeconds (m_id % 1000), &Terminal::Subframe, this);
+}
+
+uint64_t
+Terminal::GetEvents (void) const
+{
+  return m_events;
+}
+
+void
+Terminal::Subframe (void)
+{
+  ++m_events;
+  ++m_frame;
+  Simulator::Schedule (MicroSeconds (500), &Terminal::Process, this);
+  if (m_frame % 5 == 0)
+    {
+      Simulator::Schedule (MicroSeconds (100), &Terminal::Report, this, m_id, -80.0 - m_frame % 7, -10.0);
+    }
+  Simulator::Schedule (MilliSeconds (1), &Terminal::Subframe, this);
+}
+
+void
+Terminal::Process (void)
+{
+  ++m_events;
+}
+
+void
+Terminal::Report (uint16_t id, double rsrp, double rsrq)
+{
+  ++m_events;
+}
+
+/**
+ * Run the workload and report the number of events executed per second.
+ *
+ * \param nTerminals the number of terminals
+ * \param duration the simulated time
+ * \param pool whether the pool is enabled
+ */
+static void
+Measure (uint32_t nTerminals, Time duration, bool pool)
+{
+  Config::SetGlobal ("EventImplPool", BooleanValue (pool));
+  std::vector<Terminal> terminals;
+  for (uint32_t i = 0; i < nTerminals; ++i)
+    {
+      terminals.push_back (Terminal (i));
+    }
+  for (uint32_t i = 0; i < nTerminals; ++i)
+    {
+      terminals[i].Start ();
+    }
+  Simulator::Stop (duration);
+
+  SystemWallClockMs clock;
+  clock.Start ();
+  Simulator::Run ();
+  int64_t ms = clock.End ();
+  Simulator::Destroy ();
+
+  uint64_t events = 0;
+  for (uint32_t i = 0; i < nTerminals; ++i)
+    {
+      events += terminals[i].GetEvents ();
+    }
+  std::cout << std::setw (10) << (pool ? "enabled" : "disabled")
+            << std::setw (14) << events
+            << std::setw (12) << ms
+            << std::setw (16) << (ms > 0 ? events * 1000.0 / ms : 0) << std::endl;
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t nTerminals = 200;
+  uint32_t duration = 20;
+  uint32_t runs = 3;
+
+  CommandLine cmd;
+  cmd.AddValue ("terminals", "Number of terminals", nTerminals);
+  cmd.AddValue ("duration", "Simulated time of each run (s)", duration);
+  cmd.AddValue ("runs", "Number of runs in each mode", runs);
+  cmd.Parse (argc, argv);
+
+  std::cout << std::setw (10) << "pool" << std::setw (14) << "events"
+            << std::setw (12) << "time (ms)" << std::setw (16) << "events/s" << std::endl;
+  for (uint32_t run = 0; run < runs; ++run)
+    {
+      Measure (nTerminals, Seconds (duration), false);
+      Measure (nTerminals, Seconds (duration), true);
+    }
+  return 0;
+}
@@ -0,0 +1,189 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program compares the event schedulers on a mix of events typical
+// of network simulations.
+//
+// Each of a number of flows receives packets at exponentially distributed
+// intervals. Each packet restarts a retransmission timer of the flow,
+// which cancels the previous timer event, so most of the timer events
+// are cancelled before they expire, as with the TCP retransmission
+// timeouts, the RLC reordering timers or the handover time-to-trigger.
+// Each flow also has a periodic event, as the subframes of a cellular
+// simulation. The number of events executed per second, including the
+// cancelled ones, is reported for each scheduler. The ListScheduler,
+// whose insertion is linear in the number of pending events, is only
+// usable with few flows and is not run by default.
+//
+// Sample usage:
+//   ./waf --run 'scheduler-benchmark --flows=2000 --duration=5'
+//   ./waf --run 'scheduler-benchmark --flows=100 --schedulers=ns3::ListScheduler,ns3::DaryHeapScheduler'
+
+#include "ns3/core-module.h"
+#include "ns3/system-wall-clock-ms.h"
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+
+using namespace ns3;
+
+/**
+ * A flow restarting its timer at each packet.
+ */
+class Flow
+{
+public:
+  /**
+   * Constructor.
+   * \param interval the random interval between packets
+   * \param timeout the timeout of the timer
+   * \param period the period of the periodic event
+   */
+  Flow (Ptr<RandomVariableStream> interval, Time timeout, Time period);
+
+  /** Schedule the first events. */
+  void Start (void);
+  /** \returns the number of events executed. */
+  uint64_t GetEvents (void) const;
+
+private:
+  /** Reception of a packet, which restarts the timer. */
+  void Packet (void);
+  /** Expiration of the timer. */
+  void Timeout (void);
+  /** Periodic event. */
+  void Periodic (void);
+
+  Ptr<RandomVariableStream> m_interval; //!< The interval between packets.
+  Time m_timeout;                       //!< The timeout of the timer.
+  Time m_period;                        //!< The period of the periodic event.
+  EventId m_timer;                      //!< The timer event.
+  uint64_t m_events;                    //!< The number of events executed.
+};
+
+Flow::Flow (Ptr<RandomVariableStream> interval, Time timeout, Time period)
+  : m_interval (interval),
+    m_timeout (timeout),
+    m_period (period),
+    m_events (0)
+{
+}
+
+void
+Flow::Start (void)
+{
+  Simulator::Schedule (MicroSeconds (m_interval->GetValue ()), &Flow::Packet, this);
+  Simulator::Schedule (MicroSeconds (m_interval->GetValue ()), &Flow::Periodic, this);
+}
+
+uint64_t
+Flow::GetEvents (void) const
+{
+  return m_events;
+}
+
+void
+Flow::Packet (void)
+{
+  ++m_events;
+  m_timer.Cancel ();
+  m_timer = Simulator::Schedule (m_timeout, &Flow::Timeout, this);
+  Simulator::Schedule (MicroSeconds (m_interval->GetValue ()), &Flow::Packet, this);
+}
+
+void
+Flow::Timeout (void)
+{
+  ++m_events;
+}
+
+void
+Flow::Periodic (void)
+{
+  ++m_events;
+  Simulator::Schedule (m_period, &Flow::Periodic, this);
+}
+
+/**
+ * Run the event mix with a scheduler.
+ *
+ * \param scheduler the TypeId name of the scheduler
+ * \param nFlows the number of flows
+ * \param duration the simulated time
+ */
+static void
+Measure (std::string scheduler, uint32_t nFlows, Time duration)
+{
+  ObjectFactory factory;
+  factory.SetTypeId (scheduler);
+  Simulator::SetScheduler (factory);
+
+  RngSeedManager::SetRun (1);
+  Ptr<ExponentialRandomVariable> interval = CreateObject<ExponentialRandomVariable> ();
+  interval->SetAttribute ("Mean", DoubleValue (2000));
+  interval->SetStream (1);
+  std::vector<Flow> flows;
+  for (uint32_t i = 0; i < nFlows; ++i)
+    {
+      flows.push_back (Flow (interval, MilliSeconds (200), MilliSeconds (1)));
+    }
+  for (uint32_t i = 0; i < nFlows; ++i)
+    {
+      flows[i].Start ();
+    }
+  Simulator::Stop (duration);
+
+  SystemWallClockMs clock;
+  clock.Start ();
+  Simulator::Run ();
+  int64_t ms = clock.End ();
+  Simulator::Destroy ();
+
+  uint64_t events = 0;
+  for (uint32_t i = 0; i < nFlows; ++i)
+    {
+      events += flows[i].GetEvents ();
+    }
+  std::cout << std::setw (26) << scheduler
+            << std::setw (12) << events
+            << std::setw (12) << ms
+            << std::setw (14) << (ms > 0 ? events * 1000.0 / ms : 0) << std::endl;
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t nFlows = 1000;
+  uint32_t duration = 2;
+  std::string schedulers = "ns3::MapScheduler,ns3::HeapScheduler,"
+    "ns3::CalendarScheduler,ns3::DaryHeapScheduler";
+
+  CommandLine cmd;
+  cmd.AddValue ("flows", "Number of flows", nFlows);
+  cmd.AddValue ("duration", "Simulated time (s)", duration);
+  cmd.AddValue ("schedulers", "Comma-separated list of the schedulers to compare", schedulers);
+  cmd.Parse (argc, argv);
+
+  std::cout << std::setw (26) << "scheduler" << std::setw (12) << "events"
+            << std::setw (12) << "time (ms)" << std::setw (14) << "events/s" << std::endl;
+  std::istringstream iss (schedulers);
+  std::string scheduler;
+  while (std::getline (iss, scheduler, ','))
+    {
+      Measure (scheduler, nFlows, Seconds (duration));
+    }
+  return 0;
+}
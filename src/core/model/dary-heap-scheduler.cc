@@ -0,0 +1,242 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "dary-heap-scheduler.h"
+#include "event-impl.h"
+#include "assert.h"
+#include "log.h"
+
+#include <algorithm>
+
+/**
+ * \file
+ * \ingroup scheduler
+ * Implementation of ns3::DaryHeapScheduler class.
+ */
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("DaryHeapScheduler");
+
+NS_OBJECT_ENSURE_REGISTERED (DaryHeapScheduler);
+
+TypeId
+DaryHeapScheduler::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::DaryHeapScheduler")
+    .SetParent<Scheduler> ()
+    .SetGroupName ("Core")
+    .AddConstructor<DaryHeapScheduler> ()
+  ;
+  return tid;
+}
+
+DaryHeapScheduler::DaryHeapScheduler ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+DaryHeapScheduler::~DaryHeapScheduler ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+bool
+DaryHeapScheduler::IsLess (const Key &a, const Key &b)
+{
+  return a.ts < b.ts || (a.ts == b.ts && a.uid < b.uid);
+}
+
+Scheduler::Event
+DaryHeapScheduler::GetEvent (const Key &key) const
+{
+  const Slot &slot = m_slots[key.slot];
+  Scheduler::Event ev;
+  ev.impl = slot.impl;
+  ev.key.m_ts = key.ts;
+  ev.key.m_uid = key.uid;
+  ev.key.m_context = slot.context;
+  return ev;
+}
+
+void
+DaryHeapScheduler::SiftUp (std::size_t index)
+{
+  Key key = m_heap[index];
+  while (index > 0)
+    {
+      std::size_t parent = (index - 1) / ARITY;
+      if (!IsLess (key, m_heap[parent]))
+        {
+          break;
+        }
+      m_heap[index] = m_heap[parent];
+      index = parent;
+    }
+  m_heap[index] = key;
+}
+
+void
+DaryHeapScheduler::SiftDown (std::size_t index)
+{
+  std::size_t size = m_heap.size ();
+  Key key = m_heap[index];
+  while (true)
+    {
+      std::size_t first = index * ARITY + 1;
+      if (first >= size)
+        {
+          break;
+        }
+      std::size_t last = std::min (first + ARITY, size);
+      std::size_t smallest = first;
+      for (std::size_t child = first + 1; child < last; ++child)
+        {
+          if (IsLess (m_heap[child], m_heap[smallest]))
+            {
+              smallest = child;
+            }
+        }
+      if (!IsLess (m_heap[smallest], key))
+        {
+          break;
+        }
+      m_heap[index] = m_heap[smallest];
+      index = smallest;
+    }
+  m_heap[index] = key;
+}
+
+void
+DaryHeapScheduler::RemoveAt (std::size_t index)
+{
+  NS_ASSERT (index < m_heap.size ());
+  m_freeSlots.push_back (m_heap[index].slot);
+  Key last = m_heap.back ();
+  m_heap.pop_back ();
+  if (index == m_heap.size ())
+    {
+      return;
+    }
+  bool up = index > 0 && IsLess (last, m_heap[(index - 1) / ARITY]);
+  m_heap[index] = last;
+  if (up)
+    {
+      SiftUp (index);
+    }
+  else
+    {
+      SiftDown (index);
+    }
+}
+
+void
+DaryHeapScheduler::Insert (const Scheduler::Event &ev)
+{
+  NS_LOG_FUNCTION (this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+  Key key;
+  key.ts = ev.key.m_ts;
+  key.uid = ev.key.m_uid;
+  if (m_freeSlots.empty ())
+    {
+      key.slot = m_slots.size ();
+      m_slots.push_back (Slot ());
+    }
+  else
+    {
+      key.slot = m_freeSlots.back ();
+      m_freeSlots.pop_back ();
+    }
+  m_slots[key.slot].impl = ev.impl;
+  m_slots[key.slot].context = ev.key.m_context;
+  m_heap.push_back (key);
+  SiftUp (m_heap.size () - 1);
+}
+
+bool
+DaryHeapScheduler::IsEmpty (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_heap.empty ();
+}
+
+Scheduler::Event
+DaryHeapScheduler::PeekNext (void) const
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT (!IsEmpty ());
+  return GetEvent (m_heap.front ());
+}
+
+Scheduler::Event
+DaryHeapScheduler::RemoveNext (void)
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT (!IsEmpty ());
+  Scheduler::Event next = GetEvent (m_heap.front ());
+  RemoveAt (0);
+  return next;
+}
+
+void
+DaryHeapScheduler::Remove (const Scheduler::Event &ev)
+{
+  NS_LOG_FUNCTION (this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+  for (std::size_t i = 0; i < m_heap.size (); ++i)
+    {
+      if (m_heap[i].uid == ev.key.m_uid && m_heap[i].ts == ev.key.m_ts)
+        {
+          NS_ASSERT (m_slots[m_heap[i].slot].impl == ev.impl);
+          RemoveAt (i);
+          return;
+        }
+    }
+  NS_ASSERT (false);
+}
+
+uint32_t
+DaryHeapScheduler::RemoveCancelled (void)
+{
+  NS_LOG_FUNCTION (this);
+  std::size_t kept = 0;
+  for (std::size_t i = 0; i < m_heap.size (); ++i)
+    {
+      Slot &slot = m_slots[m_heap[i].slot];
+      if (slot.impl->IsCancelled ())
+        {
+          slot.impl->Unref ();
+          slot.impl = 0;
+          m_freeSlots.push_back (m_heap[i].slot);
+        }
+      else
+        {
+          m_heap[kept++] = m_heap[i];
+        }
+    }
+  uint32_t removed = m_heap.size () - kept;
+  m_heap.resize (kept);
+  if (removed > 0 && kept > 1)
+    {
+      for (std::size_t i = (kept - 2) / ARITY + 1; i > 0; --i)
+        {
+          SiftDown (i - 1);
+        }
+    }
+  NS_LOG_DEBUG ("removed " << removed << " cancelled events, " << kept << " left");
+  return removed;
+}
+
+} // namespace ns3
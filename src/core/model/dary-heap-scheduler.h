@@ -0,0 +1,129 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef DARY_HEAP_SCHEDULER_H
+#define DARY_HEAP_SCHEDULER_H
+
+#include "scheduler.h"
+#include <stdint.h>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup scheduler
+ * ns3::DaryHeapScheduler declaration.
+ */
+
+namespace ns3 {
+
+/**
+ * \ingroup scheduler
+ * \brief a d-ary heap event scheduler
+ *
+ * This event scheduler is a heap in which each node has four children.
+ * The heap only holds compact 16-byte keys (the time stamp, the uid and
+ * the index of the rest of the event in a separate array), so that the
+ * four children of a node fit in a cache line and a heap of a given
+ * depth holds many more events than a binary heap.
+ *
+ * Cancelled events stay in the heap until they expire, as with the other
+ * schedulers, unless the simulator implementation asks for their removal
+ * with RemoveCancelled(), which removes all of them in a single pass.
+ * DefaultSimulatorImpl does so when most of the events of the list are
+ * cancelled, which is typical of the timers which are restarted by each
+ * packet.
+ *
+ * Insert and RemoveNext are O(log(n)); Remove of an arbitrary event
+ * needs a linear search, as with HeapScheduler.
+ */
+class DaryHeapScheduler : public Scheduler
+{
+public:
+  /**
+   *  Register this type.
+   *  \return The object TypeId.
+   */
+  static TypeId GetTypeId (void);
+
+  /** Constructor. */
+  DaryHeapScheduler ();
+  /** Destructor. */
+  virtual ~DaryHeapScheduler ();
+
+  // Inherited
+  virtual void Insert (const Scheduler::Event &ev);
+  virtual bool IsEmpty (void) const;
+  virtual Scheduler::Event PeekNext (void) const;
+  virtual Scheduler::Event RemoveNext (void);
+  virtual void Remove (const Scheduler::Event &ev);
+  virtual uint32_t RemoveCancelled (void);
+
+private:
+  /** The number of children of each node. */
+  static const std::size_t ARITY = 4;
+
+  /** The sorting key of an event, stored in the heap. */
+  struct Key
+  {
+    uint64_t ts;    //!< The time stamp of the event.
+    uint32_t uid;   //!< The uid of the event.
+    uint32_t slot;  //!< The index of the rest of the event in m_slots.
+  };
+
+  /** The rest of an event, which is not needed to sort it. */
+  struct Slot
+  {
+    EventImpl *impl;   //!< The event implementation.
+    uint32_t context;  //!< The context of the event.
+  };
+
+  /**
+   * Compare two keys.
+   * \param [in] a The first key.
+   * \param [in] b The second key.
+   * \returns \c true if \p a expires before \p b.
+   */
+  static bool IsLess (const Key &a, const Key &b);
+  /**
+   * Build an event from its key.
+   * \param [in] key The key of the event.
+   * \returns The event.
+   */
+  Scheduler::Event GetEvent (const Key &key) const;
+  /**
+   * Move the key at an index up to its place.
+   * \param [in] index The index of the key.
+   */
+  void SiftUp (std::size_t index);
+  /**
+   * Move the key at an index down to its place.
+   * \param [in] index The index of the key.
+   */
+  void SiftDown (std::size_t index);
+  /**
+   * Remove the key at an index from the heap, and free its slot.
+   * \param [in] index The index of the key.
+   */
+  void RemoveAt (std::size_t index);
+
+  std::vector<Key> m_heap;             //!< The keys, managed as a heap.
+  std::vector<Slot> m_slots;           //!< The rest of the events.
+  std::vector<uint32_t> m_freeSlots;   //!< The unused entries of m_slots.
+};
+
+} // namespace ns3
+
+#endif /* DARY_HEAP_SCHEDULER_H */
@@ -71,6 +71,7 @@ DefaultSimulatorImpl::DefaultSimulatorImpl ()
   m_currentTs = 0;
   m_currentContext = Simulator::NO_CONTEXT;
   m_unscheduledEvents = 0;
+  m_cancelledEvents = 0;
   m_eventsWithContextEmpty = true;
   m_main = SystemThread::Self();
 }
@@ -146,6 +147,10 @@ DefaultSimulatorImpl::ProcessOneEvent (void)
   m_currentTs = next.key.m_ts;
   m_currentContext = next.key.m_context;
   m_currentUid = next.key.m_uid;
+  if (m_cancelledEvents > 0 && next.impl->IsCancelled ())
+    {
+      m_cancelledEvents--;
+    }
   next.impl->Invoke ();
   next.impl->Unref ();
 
@@ -276,6 +281,46 @@ DefaultSimulatorImpl::ScheduleWithContext (uint32_t context, Time const &delay,
     }
 }
 
+void
+DefaultSimulatorImpl::ScheduleBatch (const EventBatch &batch)
+{
+  NS_LOG_FUNCTION (this << batch.GetN ());
+
+  std::size_t n = batch.GetN ();
+  if (SystemThread::Equals (m_main))
+    {
+      Scheduler::Event ev;
+      for (std::size_t i = 0; i < n; ++i)
+        {
+          const EventBatch::Entry &entry = batch.Get (i);
+          entry.event->Ref ();
+          ev.impl = entry.event;
+          ev.key.m_ts = m_currentTs + entry.delay.GetTimeStep ();
+          ev.key.m_context = entry.context;
+          ev.key.m_uid = m_uid;
+          m_uid++;
+          m_events->Insert (ev);
+        }
+      m_unscheduledEvents += n;
+    }
+  else
+    {
+      EventWithContext ev;
+      CriticalSection cs (m_eventsWithContextMutex);
+      for (std::size_t i = 0; i < n; ++i)
+        {
+          const EventBatch::Entry &entry = batch.Get (i);
+          entry.event->Ref ();
+          ev.context = entry.context;
+          // Current time added in ProcessEventsWithContext()
+          ev.timestamp = entry.delay.GetTimeStep ();
+          ev.event = entry.event;
+          m_eventsWithContext.push_back (ev);
+        }
+      m_eventsWithContextEmpty = false;
+    }
+}
+
 EventId
 DefaultSimulatorImpl::ScheduleNow (EventImpl *event)
 {
@@ -362,6 +407,19 @@ DefaultSimulatorImpl::Cancel (const EventId &id)
   if (!IsExpired (id))
     {
       id.PeekEventImpl ()->Cancel ();
+      if (id.GetUid () != 2)
+        {
+          // the cancelled events are removed from the event list when
+          // they make up most of it, if the scheduler supports it.
+          m_cancelledEvents++;
+          if (m_cancelledEvents >= 1024 && 2 * m_cancelledEvents > m_unscheduledEvents)
+            {
+              uint32_t removed = m_events->RemoveCancelled ();
+              NS_LOG_LOGIC ("removed " << removed << " cancelled events");
+              m_unscheduledEvents -= removed;
+              m_cancelledEvents = 0;
+            }
+        }
     }
 }
 
@@ -65,6 +65,7 @@ public:
   virtual void Stop (const Time &delay);
   virtual EventId Schedule (const Time &delay, EventImpl *event);
   virtual void ScheduleWithContext (uint32_t context, const Time &delay, EventImpl *event);
+  virtual void ScheduleBatch (const EventBatch &batch);
   virtual EventId ScheduleNow (EventImpl *event);
   virtual EventId ScheduleDestroy (EventImpl *event);
   virtual void Remove (const EventId &id);
@@ -129,6 +130,11 @@ private:
    *  not counting the Destroy events; this is used for validation
    */
   int m_unscheduledEvents;
+  /**
+   * Number of events of the event list which have been cancelled, used
+   * to decide when to ask the scheduler to remove them.
+   */
+  int m_cancelledEvents;
 
   /** Main execution thread. */
   SystemThread::ThreadId m_main;
@@ -0,0 +1,67 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "event-batch.h"
+#include "event-impl.h"
+#include "assert.h"
+#include "log.h"
+
+/**
+ * \file
+ * \ingroup events
+ * ns3::EventBatch implementation.
+ */
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("EventBatch");
+
+EventBatch::EventBatch ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+EventBatch::~EventBatch ()
+{
+  NS_LOG_FUNCTION (this);
+  Clear ();
+}
+
+void
+EventBatch::Add (uint32_t context, const Time &delay, EventImpl *event)
+{
+  NS_LOG_FUNCTION (this << context << delay.GetTimeStep () << event);
+  NS_ASSERT (event != 0);
+  Entry entry;
+  entry.context = context;
+  entry.delay = delay;
+  entry.event = event;
+  m_entries.push_back (entry);
+}
+
+void
+EventBatch::Clear (void)
+{
+  NS_LOG_FUNCTION (this);
+  for (std::vector<Entry>::const_iterator i = m_entries.begin (); i != m_entries.end (); ++i)
+    {
+      i->event->Unref ();
+    }
+  m_entries.clear ();
+}
+
+} // namespace ns3
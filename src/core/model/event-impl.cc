@@ -21,6 +21,9 @@
 #include "event-impl.h"
 #include "log.h"
 
+#include <cstdlib>
+#include <new>
+
 /**
  * \file
  * \ingroup events
@@ -31,6 +34,142 @@ namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("EventImpl");
 
+namespace {
+
+/** The size classes of the pool are multiples of this size. */
+const std::size_t POOL_GRANULARITY = 16;
+/** The largest event recycled by the pool. */
+const std::size_t POOL_MAX_SIZE = 256;
+/** The number of size classes. */
+const std::size_t POOL_CLASSES = POOL_MAX_SIZE / POOL_GRANULARITY;
+/** The largest number of free blocks kept per size class. */
+const uint32_t POOL_MAX_BLOCKS = 1 << 16;
+
+/** A free block, linked to the next free block of its size class. */
+struct FreeBlock
+{
+  FreeBlock *next;  //!< The next free block.
+};
+
+/**
+ * The free lists of a thread.
+ *
+ * This is a plain structure, zero-initialized, so that accessing the
+ * pool of the current thread needs no initialization check.
+ */
+struct EventPool
+{
+  FreeBlock *head[POOL_CLASSES];  //!< The free list of each size class.
+  uint32_t count[POOL_CLASSES];   //!< The length of each free list.
+  bool registered;                //!< Whether the cleanup is registered.
+  /**
+   * Whether the pool is destroyed, in which case the events released
+   * later, by the destructors of static objects, go back to the heap.
+   */
+  bool destroyed;
+};
+
+/**
+ * Return the blocks of the pool of a thread to the heap when the thread
+ * exits. Registered on the first block added to the pool.
+ */
+struct EventPoolCleanup
+{
+  ~EventPoolCleanup ();
+  EventPool *pool;  //!< The pool of the thread.
+};
+
+/** Whether the memory of the events is recycled. */
+bool g_poolEnabled = false;
+/** The pool of the current thread. */
+thread_local EventPool g_pool;
+/** The cleanup of the pool of the current thread. */
+thread_local EventPoolCleanup g_poolCleanup;
+
+EventPoolCleanup::~EventPoolCleanup ()
+{
+  if (pool == 0)
+    {
+      return;
+    }
+  for (std::size_t i = 0; i < POOL_CLASSES; ++i)
+    {
+      while (pool->head[i] != 0)
+        {
+          FreeBlock *block = pool->head[i];
+          pool->head[i] = block->next;
+          std::free (block);
+        }
+      pool->count[i] = 0;
+    }
+  pool->destroyed = true;
+}
+
+} // unnamed namespace
+
+void *
+EventImpl::operator new (std::size_t size)
+{
+  if (size <= POOL_MAX_SIZE)
+    {
+      std::size_t sizeClass = (size + POOL_GRANULARITY - 1) / POOL_GRANULARITY - 1;
+      if (g_poolEnabled && g_pool.head[sizeClass] != 0)
+        {
+          FreeBlock *block = g_pool.head[sizeClass];
+          g_pool.head[sizeClass] = block->next;
+          g_pool.count[sizeClass]--;
+          return block;
+        }
+      size = (sizeClass + 1) * POOL_GRANULARITY;
+    }
+  void *p = std::malloc (size);
+  if (p == 0)
+    {
+      throw std::bad_alloc ();
+    }
+  return p;
+}
+
+void
+EventImpl::operator delete (void *p, std::size_t size)
+{
+  if (p == 0)
+    {
+      return;
+    }
+  if (g_poolEnabled && !g_pool.destroyed && size <= POOL_MAX_SIZE)
+    {
+      if (!g_pool.registered)
+        {
+          g_pool.registered = true;
+          g_poolCleanup.pool = &g_pool;
+        }
+      std::size_t sizeClass = (size + POOL_GRANULARITY - 1) / POOL_GRANULARITY - 1;
+      if (g_pool.count[sizeClass] < POOL_MAX_BLOCKS)
+        {
+          FreeBlock *block = static_cast<FreeBlock *> (p);
+          block->next = g_pool.head[sizeClass];
+          g_pool.head[sizeClass] = block;
+          g_pool.count[sizeClass]++;
+          return;
+        }
+    }
+  std::free (p);
+}
+
+void
+EventImpl::EnablePool (bool enable)
+{
+  // no logging: called by Simulator::GetImpl, see there
+  g_poolEnabled = enable;
+}
+
+bool
+EventImpl::IsPoolEnabled (void)
+{
+  return g_poolEnabled;
+}
+
 EventImpl::~EventImpl ()
 {
   NS_LOG_FUNCTION (this);
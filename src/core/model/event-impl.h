@@ -21,6 +21,7 @@
 #define EVENT_IMPL_H
 
 #include <stdint.h>
+#include <cstddef>
 #include "simple-ref-count.h"
 
 /**
@@ -40,6 +41,13 @@ namespace ns3 {
  * when it reaches the time associated to this event. Most subclasses
  * are usually created by one of the many Simulator::Schedule
  * methods.
+ *
+ * The memory of the events can be recycled by a per-thread pool with
+ * one free list per size class, instead of being returned to the heap
+ * when an event is released: see EnablePool(). The pool is enabled at
+ * the creation of the simulator implementation according to the
+ * "EventImplPool" global value, whose default is set by the
+ * \c --enable-event-pool configuration option.
  */
 class EventImpl : public SimpleRefCount<EventImpl>
 {
@@ -66,6 +74,33 @@ public:
    */
   bool IsCancelled (void);
 
+  /**
+   * Allocate the memory of an event.
+   *
+   * The size is rounded up to its size class whether the pool is
+   * enabled or not, so the memory of an event can be released in either
+   * mode.
+   *
+   * \param [in] size The size of the event.
+   * \returns The memory of the event.
+   */
+  static void * operator new (std::size_t size);
+  /**
+   * Release the memory of an event, to the pool if it is enabled.
+   *
+   * \param [in] p The memory of the event.
+   * \param [in] size The size of the event.
+   */
+  static void operator delete (void *p, std::size_t size);
+  /**
+   * Enable or disable the recycling of the memory of the events.
+   *
+   * \param [in] enable Whether the pool is enabled.
+   */
+  static void EnablePool (bool enable);
+  /** \returns \c true if the pool is enabled. */
+  static bool IsPoolEnabled (void);
+
 protected:
   /**
    * Implementation for Invoke().
@@ -135,6 +135,17 @@ public:
    * \param [in] ev The event to remove
    */
   virtual void Remove (const Event &ev) = 0;
+  /**
+   * Remove all the cancelled events from the event list, and release
+   * them with SimpleRefCount::Unref.
+   *
+   * The simulator implementation may call this when many of the events
+   * of the list are cancelled, instead of waiting for each of them to
+   * expire. The default implementation keeps the cancelled events.
+   *
+   * \returns The number of events removed.
+   */
+  virtual uint32_t RemoveCancelled (void);
 };
 
 /**
@@ -42,4 +42,16 @@ SimulatorImpl::GetTypeId (void)
   return tid;
 }
 
+void
+SimulatorImpl::ScheduleBatch (const EventBatch &batch)
+{
+  NS_LOG_FUNCTION (this << batch.GetN ());
+  for (std::size_t i = 0; i < batch.GetN (); ++i)
+    {
+      const EventBatch::Entry &entry = batch.Get (i);
+      entry.event->Ref ();
+      ScheduleWithContext (entry.context, entry.delay, entry.event);
+    }
+}
+
 } // namespace ns3
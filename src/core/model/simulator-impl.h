@@ -23,6 +23,7 @@
 
 #include "event-impl.h"
 #include "event-id.h"
+#include "event-batch.h"
 #include "nstime.h"
 #include "object.h"
 #include "object-factory.h"
@@ -67,6 +68,16 @@ public:
   virtual EventId Schedule (const Time &delay, EventImpl *event) = 0;
   /** \copydoc Simulator::ScheduleWithContext(uint32_t,const Time&,EventImpl*) */
   virtual void ScheduleWithContext (uint32_t context, const Time &delay, EventImpl *event) = 0;
+  /**
+   * Schedule the events of a batch, each with its own context.
+   *
+   * The batch keeps its references to the events, so the simulator
+   * takes a reference of its own to each of them. The default
+   * implementation calls ScheduleWithContext for each event, in order.
+   *
+   * \param [in] batch The events to schedule.
+   */
+  virtual void ScheduleBatch (const EventBatch &batch);
   /** \copydoc Simulator::ScheduleNow(const Ptr<EventImpl>&) */
   virtual EventId ScheduleNow (EventImpl *event) = 0;
   /** \copydoc Simulator::ScheduleDestroy(const Ptr<EventImpl>&) */
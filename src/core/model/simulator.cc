@@ -27,6 +27,7 @@
 
 #include "ptr.h"
 #include "string.h"
+#include "boolean.h"
 #include "object-factory.h"
 #include "global-value.h"
 #include "assert.h"
@@ -77,6 +78,21 @@ static GlobalValue g_schedTypeImpl = GlobalValue ("SchedulerType",
                                                   TypeIdValue (MapScheduler::GetTypeId ()),
                                                   MakeTypeIdChecker ());
 
+/**
+ * \ingroup events
+ * Whether the memory of the events is recycled, see EventImpl::EnablePool().
+ *
+ * Read when the simulator implementation is created.
+ */
+static GlobalValue g_eventImplPool = GlobalValue ("EventImplPool",
+                                                  "Recycle the memory of the events in per-thread free lists",
+#ifdef NS3_EVENT_IMPL_POOL
+                                                  BooleanValue (true),
+#else
+                                                  BooleanValue (false),
+#endif
+                                                  MakeBooleanChecker ());
+
 /**
  * \ingroup logging
  * Default TimePrinter implementation.
@@ -172,6 +188,11 @@ static SimulatorImpl * GetImpl (void)
         factory.SetTypeId (s.Get ());
         (*pimpl)->SetScheduler (factory);
       }
+      {
+        BooleanValue pool;
+        g_eventImplPool.GetValue (pool);
+        EventImpl::EnablePool (pool.Get ());
+      }
 
 //
 // Note: we call LogSetTimePrinter _after_ creating the implementation
@@ -280,6 +301,23 @@ Simulator::ScheduleWithContext (uint32_t context, const Time &delay, EventImpl *
 #endif
   return GetImpl ()->ScheduleWithContext (context, delay, impl);
 }
+void
+Simulator::ScheduleBatch (EventBatch &batch)
+{
+  if (batch.IsEmpty ())
+    {
+      return;
+    }
+#ifdef ENABLE_DES_METRICS
+  for (std::size_t i = 0; i < batch.GetN (); ++i)
+    {
+      DesMetrics::Get ()->TraceWithContext (batch.Get (i).context, Now (), batch.Get (i).delay);
+    }
+#endif
+  GetImpl ()->ScheduleBatch (batch);
+  batch.Clear ();
+}
+
 EventId
 Simulator::ScheduleDestroy (const Ptr<EventImpl> &ev)
 {
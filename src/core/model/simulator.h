@@ -23,6 +23,7 @@
 
 #include "event-id.h"
 #include "event-impl.h"
+#include "event-batch.h"
 #include "make-event.h"
 #include "nstime.h"
 
@@ -1296,6 +1297,18 @@ public:
    */
   static void ScheduleWithContext (uint32_t context, const Time &delay, EventImpl *event);
 
+  /**
+   * Schedule all the events of a batch, each in its own context, and
+   * clear the batch.
+   *
+   * This is equivalent to calling ScheduleWithContext for each event of
+   * the batch, in order, but lets the simulator implementation insert
+   * them together. Like ScheduleWithContext, this method is thread-safe.
+   *
+   * @param [in,out] batch The events to schedule.
+   */
+  static void ScheduleBatch (EventBatch &batch);
+
   /**
    * Schedule an event to run at the end of the simulation, after
    * the Stop() time or condition has been reached.
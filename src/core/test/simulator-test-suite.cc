@@ -23,6 +23,14 @@
 #include "ns3/heap-scheduler.h"
 #include "ns3/map-scheduler.h"
 #include "ns3/calendar-scheduler.h"
+#include "ns3/dary-heap-scheduler.h"
+#include "ns3/event-impl.h"
+#include "ns3/global-value.h"
+#include "ns3/boolean.h"
+#include "ns3/config.h"
+#include <sstream>
+#include <string>
+#include <vector>
 
 using namespace ns3;
 
@@ -461,6 +469,336 @@ SimulatorTemplateTestCase::DoRun (void)
   Simulator::Destroy ();
 }
 
+class SimulatorBatchTestCase : public TestCase
+{
+public:
+  SimulatorBatchTestCase ();
+private:
+  virtual void DoRun (void);
+  /**
+   * Schedule the events of the test, individually or in a batch.
+   * \param batch whether to use a batch
+   * \returns the order in which the events ran, as "time context id"
+   */
+  std::vector<std::string> Run (bool batch);
+  void Record (int id);
+  void Fail (void);
+  std::vector<std::string> m_order;
+};
+
+SimulatorBatchTestCase::SimulatorBatchTestCase ()
+  : TestCase ("Check that a batch of events runs like the same events scheduled one by one")
+{
+}
+
+void
+SimulatorBatchTestCase::Record (int id)
+{
+  std::ostringstream oss;
+  oss << Simulator::Now ().GetMicroSeconds () << " " << Simulator::GetContext () << " " << id;
+  m_order.push_back (oss.str ());
+}
+
+void
+SimulatorBatchTestCase::Fail (void)
+{
+  NS_TEST_ASSERT_MSG_EQ (true, false, "released event should not run");
+}
+
+std::vector<std::string>
+SimulatorBatchTestCase::Run (bool batch)
+{
+  m_order.clear ();
+  EventBatch events;
+  for (int id = 0; id < 20; ++id)
+    {
+      // several events with the same time, interleaved with events
+      // scheduled individually
+      Time delay = MicroSeconds (10 * (id % 4));
+      uint32_t context = 100 + id % 3;
+      if (batch)
+        {
+          events.Add (context, delay, &SimulatorBatchTestCase::Record, this, id);
+        }
+      else
+        {
+          Simulator::ScheduleWithContext (context, delay, &SimulatorBatchTestCase::Record, this, id);
+        }
+    }
+  NS_TEST_EXPECT_MSG_EQ (events.GetN (), batch ? 20 : 0, "wrong number of events in the batch");
+  Simulator::ScheduleBatch (events);
+  NS_TEST_EXPECT_MSG_EQ (events.IsEmpty (), true, "batch not cleared");
+  Simulator::Schedule (MicroSeconds (10), &SimulatorBatchTestCase::Record, this, 20);
+
+  // events not scheduled are released with the batch
+  EventBatch released;
+  released.Add (0, MicroSeconds (0), &SimulatorBatchTestCase::Fail, this);
+  released.Clear ();
+  released.Add (0, MicroSeconds (0), &SimulatorBatchTestCase::Fail, this);
+
+  Simulator::Run ();
+  Simulator::Destroy ();
+  return m_order;
+}
+
+void
+SimulatorBatchTestCase::DoRun (void)
+{
+  std::vector<std::string> individual = Run (false);
+  std::vector<std::string> batch = Run (true);
+  NS_TEST_ASSERT_MSG_EQ (individual.size (), 21, "events missing");
+  NS_TEST_ASSERT_MSG_EQ (batch.size (), individual.size (), "events missing in the batch");
+  for (uint32_t i = 0; i < individual.size (); ++i)
+    {
+      NS_TEST_EXPECT_MSG_EQ (batch[i], individual[i], "different event order at " << i);
+    }
+}
+
+class SimulatorEventPoolTestCase : public TestCase
+{
+public:
+  SimulatorEventPoolTestCase ();
+private:
+  virtual void DoRun (void);
+  /**
+   * Schedule the next event of a chain, with arguments of another size.
+   * \param remaining the number of events left in the chain
+   * \param a an argument
+   * \param b an argument
+   */
+  void Chain (uint32_t remaining, double a, uint64_t b);
+  void Fail (void);
+  uint32_t m_count;
+};
+
+SimulatorEventPoolTestCase::SimulatorEventPoolTestCase ()
+  : TestCase ("Check that events run and their memory is recycled with the event pool")
+{
+}
+
+void
+SimulatorEventPoolTestCase::Chain (uint32_t remaining, double a, uint64_t b)
+{
+  m_count++;
+  if (remaining == 0)
+    {
+      return;
+    }
+  if (remaining % 2 == 0)
+    {
+      Simulator::Schedule (MicroSeconds (1), &SimulatorEventPoolTestCase::Chain, this, remaining - 1, a, b);
+    }
+  else
+    {
+      EventId id = Simulator::Schedule (MicroSeconds (1), &SimulatorEventPoolTestCase::Fail, this);
+      Simulator::Cancel (id);
+      Simulator::ScheduleNow (&SimulatorEventPoolTestCase::Chain, this, remaining - 1, a + 1, b);
+    }
+}
+
+void
+SimulatorEventPoolTestCase::Fail (void)
+{
+  NS_TEST_ASSERT_MSG_EQ (true, false, "cancelled event should not run");
+}
+
+void
+SimulatorEventPoolTestCase::DoRun (void)
+{
+  BooleanValue saved;
+  GlobalValue::GetValueByName ("EventImplPool", saved);
+
+  for (int pool = 0; pool < 2; ++pool)
+    {
+      Config::SetGlobal ("EventImplPool", BooleanValue (pool == 1));
+      m_count = 0;
+      Simulator::Schedule (MicroSeconds (1), &SimulatorEventPoolTestCase::Chain, this, 100, 0.0, 0);
+      NS_TEST_ASSERT_MSG_EQ (EventImpl::IsPoolEnabled (), (pool == 1), "global value not applied");
+      Simulator::Run ();
+      NS_TEST_EXPECT_MSG_EQ (m_count, 101, "events missing");
+      Simulator::Destroy ();
+    }
+
+  // a released event is reused by the next event of its size
+  EventImpl::EnablePool (true);
+  EventImpl *first = MakeEvent (&SimulatorEventPoolTestCase::Fail, this);
+  first->Unref ();
+  EventImpl *second = MakeEvent (&SimulatorEventPoolTestCase::Fail, this);
+  NS_TEST_EXPECT_MSG_EQ (second, first, "memory of the event not recycled");
+  // events allocated with the pool disabled can be released to the pool,
+  // and the other way around
+  EventImpl::EnablePool (false);
+  EventImpl *third = MakeEvent (&SimulatorEventPoolTestCase::Chain, this, 0, 0.0, 0);
+  EventImpl::EnablePool (true);
+  third->Unref ();
+  EventImpl::EnablePool (false);
+  second->Unref ();
+
+  Config::SetGlobal ("EventImplPool", saved);
+  EventImpl::EnablePool (saved.Get ());
+}
+
+class SimulatorCancelledEventsTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor.
+   * \param schedulerFactory the factory of the scheduler to test
+   */
+  SimulatorCancelledEventsTestCase (ObjectFactory schedulerFactory);
+private:
+  virtual void DoRun (void);
+  /**
+   * Restart the timers of a number of flows, as the arrival of packets.
+   * \param round the number of rounds left
+   */
+  void Restart (uint32_t round);
+  void Timeout (uint32_t flow);
+  ObjectFactory m_schedulerFactory;
+  std::vector<EventId> m_timers;
+  std::vector<std::string> m_order;
+};
+
+SimulatorCancelledEventsTestCase::SimulatorCancelledEventsTestCase (ObjectFactory schedulerFactory)
+  : TestCase ("Check that many cancelled events do not run, " + schedulerFactory.GetTypeId ().GetName ()),
+    m_schedulerFactory (schedulerFactory)
+{
+}
+
+void
+SimulatorCancelledEventsTestCase::Restart (uint32_t round)
+{
+  // restart all the timers but the last few, with various timeouts
+  for (uint32_t flow = 0; flow < m_timers.size () - 10; ++flow)
+    {
+      m_timers[flow].Cancel ();
+      m_timers[flow] = Simulator::Schedule (MicroSeconds (1000 + flow % 17), &SimulatorCancelledEventsTestCase::Timeout, this, flow);
+    }
+  if (round > 0)
+    {
+      Simulator::Schedule (MicroSeconds (10), &SimulatorCancelledEventsTestCase::Restart, this, round - 1);
+    }
+}
+
+void
+SimulatorCancelledEventsTestCase::Timeout (uint32_t flow)
+{
+  std::ostringstream oss;
+  oss << Simulator::Now ().GetMicroSeconds () << " " << flow;
+  m_order.push_back (oss.str ());
+}
+
+void
+SimulatorCancelledEventsTestCase::DoRun (void)
+{
+  Simulator::SetScheduler (m_schedulerFactory);
+  m_timers.resize (1000);
+  for (uint32_t flow = 0; flow < m_timers.size (); ++flow)
+    {
+      m_timers[flow] = Simulator::Schedule (MicroSeconds (500), &SimulatorCancelledEventsTestCase::Timeout, this, flow);
+    }
+  Simulator::Schedule (MicroSeconds (10), &SimulatorCancelledEventsTestCase::Restart, this, 20);
+  Simulator::Run ();
+
+  // the last 10 timers expire at 500 us, the others 1000 us after the
+  // last restart, at 210 us, in the order of their expiration time, then
+  // of their scheduling
+  NS_TEST_ASSERT_MSG_EQ (m_order.size (), m_timers.size (), "wrong number of timeouts");
+  for (uint32_t i = 0; i < 10; ++i)
+    {
+      std::ostringstream oss;
+      oss << 500 << " " << 990 + i;
+      NS_TEST_EXPECT_MSG_EQ (m_order[i], oss.str (), "unexpected timeout " << i);
+    }
+  uint32_t i = 10;
+  for (uint32_t delay = 0; delay < 17; ++delay)
+    {
+      for (uint32_t flow = delay; flow < m_timers.size () - 10; flow += 17)
+        {
+          std::ostringstream oss;
+          oss << 1210 + delay << " " << flow;
+          NS_TEST_EXPECT_MSG_EQ (m_order[i], oss.str (), "unexpected timeout " << i);
+          ++i;
+        }
+    }
+  for (uint32_t flow = 0; flow < m_timers.size (); ++flow)
+    {
+      NS_TEST_EXPECT_MSG_EQ (m_timers[flow].IsExpired (), true, "timer not expired");
+    }
+  m_timers.clear ();
+  m_order.clear ();
+  Simulator::Destroy ();
+}
+
+class DaryHeapSchedulerTestCase : public TestCase
+{
+public:
+  DaryHeapSchedulerTestCase ();
+private:
+  virtual void DoRun (void);
+  void Nothing (void);
+};
+
+DaryHeapSchedulerTestCase::DaryHeapSchedulerTestCase ()
+  : TestCase ("Check the order of the events and the removal of the cancelled events of the d-ary heap")
+{
+}
+
+void
+DaryHeapSchedulerTestCase::Nothing (void)
+{
+}
+
+void
+DaryHeapSchedulerTestCase::DoRun (void)
+{
+  Ptr<DaryHeapScheduler> scheduler = CreateObject<DaryHeapScheduler> ();
+  std::vector<Scheduler::Event> events;
+  for (uint32_t i = 0; i < 500; ++i)
+    {
+      Scheduler::Event ev;
+      ev.impl = MakeEvent (&DaryHeapSchedulerTestCase::Nothing, this);
+      // several events with the same time stamp
+      ev.key.m_ts = (i * 7919) % 97;
+      ev.key.m_uid = 4 + i;
+      ev.key.m_context = i;
+      scheduler->Insert (ev);
+      events.push_back (ev);
+    }
+  // remove some events, cancel others
+  for (uint32_t i = 0; i < events.size (); i += 11)
+    {
+      scheduler->Remove (events[i]);
+      events[i].impl->Unref ();
+      events[i].impl = 0;
+    }
+  uint32_t cancelled = 0;
+  for (uint32_t i = 1; i < events.size (); i += 3)
+    {
+      if (events[i].impl != 0)
+        {
+          events[i].impl->Cancel ();
+          ++cancelled;
+        }
+    }
+  NS_TEST_ASSERT_MSG_EQ (scheduler->RemoveCancelled (), cancelled, "wrong number of cancelled events removed");
+
+  Scheduler::EventKey previous = { 0, 0, 0 };
+  uint32_t n = 0;
+  while (!scheduler->IsEmpty ())
+    {
+      Scheduler::Event next = scheduler->RemoveNext ();
+      NS_TEST_ASSERT_MSG_EQ (next.impl->IsCancelled (), false, "cancelled event not removed");
+      NS_TEST_ASSERT_MSG_EQ (next.key.m_context, next.key.m_uid - 4, "wrong context");
+      NS_TEST_ASSERT_MSG_EQ (events[next.key.m_context].impl, next.impl, "wrong event");
+      NS_TEST_ASSERT_MSG_EQ ((n == 0 || previous < next.key), true, "events not in order");
+      previous = next.key;
+      next.impl->Unref ();
+      ++n;
+    }
+  NS_TEST_EXPECT_MSG_EQ (n + cancelled + (events.size () + 10) / 11, events.size (), "events missing");
+}
+
 class SimulatorTestSuite : public TestSuite
 {
 public:
@@ -477,5 +815,14 @@ public:
     AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
     factory.SetTypeId (CalendarScheduler::GetTypeId ());
     AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
+    factory.SetTypeId (DaryHeapScheduler::GetTypeId ());
+    AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
+    AddTestCase (new SimulatorBatchTestCase, TestCase::QUICK);
+    AddTestCase (new SimulatorEventPoolTestCase, TestCase::QUICK);
+    factory.SetTypeId (HeapScheduler::GetTypeId ());
+    AddTestCase (new SimulatorCancelledEventsTestCase (factory), TestCase::QUICK);
+    factory.SetTypeId (DaryHeapScheduler::GetTypeId ());
+    AddTestCase (new SimulatorCancelledEventsTestCase (factory), TestCase::QUICK);
+    AddTestCase (new DaryHeapSchedulerTestCase, TestCase::QUICK);
   }
 } g_simulatorTestSuite;
@@ -0,0 +1,103 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011 Centre Tecnologic de Telecomunicacions de Catalunya (CTTC)
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program converts an ASCII fading trace, as generated by
+// fading_trace_generator.m, to the binary format that TraceFadingLossModel
+// memory-maps, and then measures the time needed to initialize a number of
+// TraceFadingLossModel instances with each of the two traces.
+// Sample usage:
+//   ./waf --run 'lena-fading-trace-converter
+//       --input=src/lte/model/fading-traces/fading_trace_EPA_3kmph.fad
+//       --output=fading_trace_EPA_3kmph.bin'
+
+#include "ns3/core-module.h"
+#include "ns3/lte-module.h"
+#include "ns3/system-wall-clock-ms.h"
+#include <iostream>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * Initialize a number of fading models with a trace, as done by
+ * LteHelper for each channel.
+ *
+ * \param filename the trace file
+ * \param models the number of fading models
+ * \param rbNum the number of RBs of the trace
+ * \param samplesNum the number of samples per RB of the trace
+ * \return the elapsed time in ms
+ */
+static int64_t
+LoadModels (std::string filename, uint32_t models, uint32_t rbNum, uint32_t samplesNum)
+{
+  SystemWallClockMs clock;
+  clock.Start ();
+  std::vector<Ptr<TraceFadingLossModel> > fadingModels;
+  for (uint32_t i = 0; i < models; ++i)
+    {
+      Ptr<TraceFadingLossModel> fading = CreateObject<TraceFadingLossModel> ();
+      fading->SetAttribute ("TraceFilename", StringValue (filename));
+      fading->SetAttribute ("RbNum", UintegerValue (rbNum));
+      fading->SetAttribute ("SamplesNum", UintegerValue (samplesNum));
+      fading->Initialize ();
+      fadingModels.push_back (fading);
+    }
+  return clock.End ();
+}
+
+int
+main (int argc, char *argv[])
+{
+  std::string input;
+  std::string output;
+  uint32_t rbNum = 100;
+  uint32_t samplesNum = 10000;
+  uint32_t models = 2;
+
+  CommandLine cmd;
+  cmd.AddValue ("input", "ASCII fading trace to convert", input);
+  cmd.AddValue ("output", "Binary fading trace to write", output);
+  cmd.AddValue ("rbNum", "Number of RBs of the trace", rbNum);
+  cmd.AddValue ("samplesNum", "Number of samples per RB of the trace", samplesNum);
+  cmd.AddValue ("models", "Number of fading models loaded to measure the loading time", models);
+  cmd.Parse (argc, argv);
+
+  if (input.empty () || output.empty ())
+    {
+      std::cerr << "both --input and --output are required" << std::endl;
+      return 1;
+    }
+
+  if (!LteFadingTrace::ConvertToBinary (input, output, rbNum, samplesNum))
+    {
+      std::cerr << "can't write " << output << std::endl;
+      return 1;
+    }
+  std::cout << "converted " << input << " to " << output << std::endl;
+
+  if (models > 0)
+    {
+      int64_t asciiMs = LoadModels (input, models, rbNum, samplesNum);
+      int64_t binaryMs = LoadModels (output, models, rbNum, samplesNum);
+      std::cout << "loading " << models << " models: ASCII " << asciiMs
+                << " ms, binary " << binaryMs << " ms" << std::endl;
+    }
+  Simulator::Destroy ();
+  return 0;
+}
@@ -0,0 +1,96 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011 Centre Tecnologic de Telecomunicacions de Catalunya (CTTC)
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program measures the cost of the MI based error model of the LTE
+// PHY for one TTI: the evaluation of the MIB of a TB spanning all the RBs,
+// and the complete TB decoding statistics, for all the MCSs, optionally
+// with the BLER lookup table.
+// Sample usage:  ./waf --run 'lena-mi-error-model-benchmark --rbNum=100 --lookup=1'
+
+#include "ns3/core-module.h"
+#include "ns3/lte-module.h"
+#include "ns3/system-wall-clock-ms.h"
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+using namespace ns3;
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t rbNum = 100;
+  uint32_t ttis = 20000;
+  bool lookup = false;
+
+  CommandLine cmd;
+  cmd.AddValue ("rbNum", "Number of RBs of the TB", rbNum);
+  cmd.AddValue ("ttis", "Number of TTIs evaluated for each MCS", ttis);
+  cmd.AddValue ("lookup", "Use the BLER lookup table of the error model", lookup);
+  cmd.Parse (argc, argv);
+
+  LteMiErrorModel::SetBlerLookupEnabled (lookup);
+
+  Ptr<const SpectrumModel> model = LteSpectrumValueHelper::GetSpectrumModel (100, rbNum);
+  SpectrumValue sinr (model);
+  std::vector<int> map;
+  for (uint32_t i = 0; i < rbNum; ++i)
+    {
+      // from -5 dB to 25 dB across the band
+      sinr[i] = std::pow (10.0, (-5.0 + 30.0 * i / rbNum) / 10.0);
+      map.push_back (i);
+    }
+  HarqProcessInfoList_t noHarq;
+  Ptr<LteAmc> amc = CreateObject<LteAmc> ();
+  std::vector<uint16_t> tbSize;
+  for (uint8_t mcs = 0; mcs <= MI_64QAM_MAX_ID; ++mcs)
+    {
+      tbSize.push_back (amc->GetDlTbSizeFromMcs (mcs, rbNum) / 8);
+    }
+
+  double checksum = 0;
+  SystemWallClockMs clock;
+  clock.Start ();
+  for (uint32_t t = 0; t < ttis; ++t)
+    {
+      for (uint8_t mcs = 0; mcs <= MI_64QAM_MAX_ID; ++mcs)
+        {
+          checksum += LteMiErrorModel::Mib (sinr, map, mcs);
+        }
+    }
+  int64_t mibMs = clock.End ();
+
+  clock.Start ();
+  for (uint32_t t = 0; t < ttis; ++t)
+    {
+      for (uint8_t mcs = 0; mcs <= MI_64QAM_MAX_ID; ++mcs)
+        {
+          checksum += LteMiErrorModel::GetTbDecodificationStats (sinr, map, tbSize[mcs], mcs, noHarq).tbler;
+        }
+    }
+  int64_t tbMs = clock.End ();
+
+  double calls = ttis * (MI_64QAM_MAX_ID + 1.0);
+  std::cout << "RBs=" << rbNum << " TTIs=" << ttis << " MCSs=" << MI_64QAM_MAX_ID + 1
+            << " lookup=" << lookup
+            << " checksum=" << std::setprecision (17) << checksum
+            << std::setprecision (6) << std::endl;
+  std::cout << "Mib:                      " << mibMs * 1e6 / calls << " ns/TB" << std::endl;
+  std::cout << "GetTbDecodificationStats: " << tbMs * 1e6 / calls << " ns/TB" << std::endl;
+  return 0;
+}
@@ -0,0 +1,216 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program measures the effect of the path loss cache of the
+// MultiModelSpectrumChannel (the EnablePathLossCache attribute) on a
+// multi-cell LTE simulation of the size of the lena-dual-stripe example:
+// macro sites of three sectors on a hexagonal grid, with the UEs dropped
+// uniformly over the grid, saturated downlink and uplink traffic and, by
+// default, the HybridBuildingsPropagationLossModel of lena-dual-stripe. The
+// wall clock time of the simulation is reported, together with the sum of
+// the RSRPs reported by the UEs, which must be the same with and without
+// the cache. Each program run measures one configuration: the shadowing of
+// the propagation loss model is drawn in the order in which the channel
+// visits the receivers, which is the order of their addresses, so two
+// simulations run in the same process do not draw the same shadowing. A
+// fraction of the UEs can move, to measure the cost of the cache misses.
+//
+// Sample usage:
+//   ./waf --run 'lena-pathloss-cache-benchmark --cache=0'
+//   ./waf --run 'lena-pathloss-cache-benchmark --cache=1'
+//   ./waf --run 'lena-pathloss-cache-benchmark --cache=1 --nSites=7 --nUes=210'
+//   ./waf --run 'lena-pathloss-cache-benchmark --cache=1 --movingUes=0.5 --ueSpeed=3'
+
+#include "ns3/core-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/lte-module.h"
+#include "ns3/buildings-module.h"
+#include "ns3/system-wall-clock-ms.h"
+#include <iostream>
+#include <iomanip>
+
+using namespace ns3;
+
+/// The sum of the RSRPs reported by the UEs.
+static double g_rsrpSum;
+/// The number of RSRPs reported by the UEs.
+static uint64_t g_rsrpReports;
+
+/**
+ * Trace sink of the RSRP and SINR reported by the UEs.
+ * \param cellId the cell ID
+ * \param rnti the RNTI
+ * \param rsrp the RSRP
+ * \param sinr the SINR
+ * \param componentCarrierId the component carrier ID
+ */
+static void
+ReportRsrpSinr (uint16_t cellId, uint16_t rnti, double rsrp, double sinr, uint8_t componentCarrierId)
+{
+  g_rsrpSum += rsrp;
+  ++g_rsrpReports;
+}
+
+/**
+ * Run the simulation.
+ *
+ * \param cache whether the path loss cache is enabled
+ * \param nSites the number of macro sites
+ * \param nUes the number of UEs
+ * \param movingUes the fraction of the UEs which move
+ * \param ueSpeed the speed of the moving UEs
+ * \param pathLossModel the TypeId name of the propagation loss model
+ * \param duration the simulated time
+ */
+static void
+Measure (bool cache, uint32_t nSites, uint32_t nUes, double movingUes, double ueSpeed,
+         std::string pathLossModel, Time duration)
+{
+  double interSiteDistance = 500;
+  Config::SetDefault ("ns3::MultiModelSpectrumChannel::EnablePathLossCache", BooleanValue (cache));
+
+  Ptr<LteHelper> lteHelper = CreateObject<LteHelper> ();
+  lteHelper->SetAttribute ("PathlossModel", StringValue (pathLossModel));
+  if (pathLossModel == "ns3::HybridBuildingsPropagationLossModel")
+    {
+      // as in lena-dual-stripe
+      lteHelper->SetPathlossModelAttribute ("ShadowSigmaExtWalls", DoubleValue (0));
+      lteHelper->SetPathlossModelAttribute ("ShadowSigmaOutdoor", DoubleValue (1));
+      lteHelper->SetPathlossModelAttribute ("ShadowSigmaIndoor", DoubleValue (1.5));
+      lteHelper->SetPathlossModelAttribute ("Los2NlosThr", DoubleValue (1e6));
+    }
+
+  NodeContainer enbNodes;
+  enbNodes.Create (3 * nSites);
+  NodeContainer ueNodes;
+  ueNodes.Create (nUes);
+
+  MobilityHelper mobility;
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.Install (enbNodes);
+  Ptr<LteHexGridEnbTopologyHelper> topologyHelper = CreateObject<LteHexGridEnbTopologyHelper> ();
+  topologyHelper->SetLteHelper (lteHelper);
+  topologyHelper->SetAttribute ("InterSiteDistance", DoubleValue (interSiteDistance));
+  topologyHelper->SetAttribute ("MinX", DoubleValue (interSiteDistance / 2));
+  topologyHelper->SetAttribute ("GridWidth", UintegerValue (std::max (1u, (uint32_t) std::sqrt (nSites))));
+  lteHelper->SetEnbAntennaModelType ("ns3::ParabolicAntennaModel");
+  lteHelper->SetEnbAntennaModelAttribute ("Beamwidth", DoubleValue (70));
+  lteHelper->SetEnbAntennaModelAttribute ("MaxAttenuation", DoubleValue (20.0));
+  NetDeviceContainer enbDevs = topologyHelper->SetPositionAndInstallEnbDevice (enbNodes);
+
+  // drop the UEs over the bounding box of the sites
+  double xMax = 0;
+  double yMax = 0;
+  for (uint32_t i = 0; i < enbNodes.GetN (); ++i)
+    {
+      Vector position = enbNodes.Get (i)->GetObject<MobilityModel> ()->GetPosition ();
+      xMax = std::max (xMax, position.x + interSiteDistance / 2);
+      yMax = std::max (yMax, position.y + interSiteDistance / 2);
+    }
+  Ptr<UniformRandomVariable> xVar = CreateObject<UniformRandomVariable> ();
+  xVar->SetAttribute ("Max", DoubleValue (xMax));
+  xVar->SetStream (1);
+  Ptr<UniformRandomVariable> yVar = CreateObject<UniformRandomVariable> ();
+  yVar->SetAttribute ("Min", DoubleValue (-interSiteDistance / 2));
+  yVar->SetAttribute ("Max", DoubleValue (yMax));
+  yVar->SetStream (2);
+  Ptr<UniformRandomVariable> angleVar = CreateObject<UniformRandomVariable> ();
+  angleVar->SetAttribute ("Max", DoubleValue (2 * M_PI));
+  angleVar->SetStream (3);
+  uint32_t nMovingUes = movingUes * nUes;
+  for (uint32_t i = 0; i < nUes; ++i)
+    {
+      Vector position (xVar->GetValue (), yVar->GetValue (), 1.5);
+      if (i < nMovingUes)
+        {
+          Ptr<ConstantVelocityMobilityModel> ueMobility = CreateObject<ConstantVelocityMobilityModel> ();
+          double angle = angleVar->GetValue ();
+          ueMobility->SetPosition (position);
+          ueMobility->SetVelocity (Vector (ueSpeed * std::cos (angle), ueSpeed * std::sin (angle), 0));
+          ueNodes.Get (i)->AggregateObject (ueMobility);
+        }
+      else
+        {
+          Ptr<ConstantPositionMobilityModel> ueMobility = CreateObject<ConstantPositionMobilityModel> ();
+          ueMobility->SetPosition (position);
+          ueNodes.Get (i)->AggregateObject (ueMobility);
+        }
+    }
+  // needed by the buildings propagation loss models, harmless for the others
+  BuildingsHelper::Install (enbNodes);
+  BuildingsHelper::Install (ueNodes);
+  BuildingsHelper::MakeMobilityModelConsistent ();
+  NetDeviceContainer ueDevs = lteHelper->InstallUeDevice (ueNodes);
+  lteHelper->AssignStreams (enbDevs, 100);
+  lteHelper->AssignStreams (ueDevs, 1000);
+  // the shadowing of the propagation loss models
+  PointerValue lossModel;
+  lteHelper->GetDownlinkSpectrumChannel ()->GetAttribute ("PropagationLossModel", lossModel);
+  lossModel.Get<PropagationLossModel> ()->AssignStreams (2000);
+  lteHelper->GetUplinkSpectrumChannel ()->GetAttribute ("PropagationLossModel", lossModel);
+  lossModel.Get<PropagationLossModel> ()->AssignStreams (3000);
+
+  // without an EPC, the data radio bearers use RLC SM, which saturates
+  // the downlink and the uplink
+  lteHelper->AttachToClosestEnb (ueDevs, enbDevs);
+  lteHelper->ActivateDataRadioBearer (ueDevs, EpsBearer (EpsBearer::NGBR_VIDEO_TCP_DEFAULT));
+
+  g_rsrpSum = 0;
+  g_rsrpReports = 0;
+  Config::ConnectWithoutContext ("/NodeList/*/DeviceList/*/ComponentCarrierMapUe/*/LteUePhy/ReportCurrentCellRsrpSinr",
+                                 MakeCallback (&ReportRsrpSinr));
+
+  Simulator::Stop (duration);
+  SystemWallClockMs clock;
+  clock.Start ();
+  Simulator::Run ();
+  int64_t ms = clock.End ();
+  Simulator::Destroy ();
+
+  std::cout << std::setw (8) << (cache ? "on" : "off")
+            << std::setw (12) << ms
+            << std::setw (12) << g_rsrpReports
+            << std::setw (24) << std::setprecision (12) << g_rsrpSum << std::endl;
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t nSites = 3;
+  uint32_t nUes = 90;
+  double movingUes = 0;
+  double ueSpeed = 3;
+  double duration = 0.5;
+  std::string pathLossModel = "ns3::HybridBuildingsPropagationLossModel";
+  bool cache = true;
+
+  CommandLine cmd;
+  cmd.AddValue ("nSites", "Number of macro sites of three sectors", nSites);
+  cmd.AddValue ("nUes", "Number of UEs", nUes);
+  cmd.AddValue ("movingUes", "Fraction of the UEs which move", movingUes);
+  cmd.AddValue ("ueSpeed", "Speed of the moving UEs (m/s)", ueSpeed);
+  cmd.AddValue ("pathLossModel", "TypeId name of the propagation loss model", pathLossModel);
+  cmd.AddValue ("duration", "Simulated time (s)", duration);
+  cmd.AddValue ("cache", "Enable the path loss cache of the channels", cache);
+  cmd.Parse (argc, argv);
+
+  std::cout << 3 * nSites << " cells, " << nUes << " UEs, "
+            << (uint32_t) (movingUes * nUes) << " moving" << std::endl;
+  std::cout << std::setw (8) << "cache" << std::setw (12) << "time (ms)"
+            << std::setw (12) << "reports" << std::setw (24) << "sum of RSRP" << std::endl;
+  Measure (cache, nSites, nUes, movingUes, ueSpeed, pathLossModel, Seconds (duration));
+  return 0;
+}
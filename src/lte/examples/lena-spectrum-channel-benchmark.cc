@@ -0,0 +1,172 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program measures the cost of the spectrum channels on a large
+// multi-cell LTE simulation: macro sites of three sectors on a hexagonal
+// grid, with the UEs dropped uniformly over the grid and saturated
+// downlink and uplink traffic. Each transmission is sent by the channel to
+// all the receivers on the same frequency; those whose path loss exceeds
+// the MaxLossDb attribute of the channel are not reached. The wall clock
+// time of the simulation is reported, together with the number of pairs of
+// transmitter and receiver evaluated by the channels, the number of
+// receivers reached, and the sum of the RSRPs reported by the UEs, which
+// allow checking that changes of the channels do not change the results.
+//
+// Sample usage:
+//   ./waf --run 'lena-spectrum-channel-benchmark --nSites=19 --maxLossDb=110'
+//   ./waf --run 'lena-spectrum-channel-benchmark --channelType=ns3::SingleModelSpectrumChannel'
+
+#include "ns3/core-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/lte-module.h"
+#include "ns3/system-wall-clock-ms.h"
+#include <iostream>
+#include <iomanip>
+
+using namespace ns3;
+
+/// The sum of the RSRPs reported by the UEs.
+static double g_rsrpSum = 0;
+/// The number of pairs of transmitter and receiver evaluated by the channels.
+static uint64_t g_pairs = 0;
+/// The number of receivers reached by the transmissions.
+static uint64_t g_reached = 0;
+
+/**
+ * Trace sink of the RSRP and SINR reported by the UEs.
+ * \param cellId the cell ID
+ * \param rnti the RNTI
+ * \param rsrp the RSRP
+ * \param sinr the SINR
+ * \param componentCarrierId the component carrier ID
+ */
+static void
+ReportRsrpSinr (uint16_t cellId, uint16_t rnti, double rsrp, double sinr, uint8_t componentCarrierId)
+{
+  g_rsrpSum += rsrp;
+}
+
+/**
+ * Trace sink of the path losses computed by the channels.
+ * \param maxLossDb the maximum loss of the channels
+ * \param txPhy the transmitter
+ * \param rxPhy the receiver
+ * \param lossDb the path loss (dB)
+ */
+static void
+PathLoss (double maxLossDb, Ptr<const SpectrumPhy> txPhy, Ptr<const SpectrumPhy> rxPhy, double lossDb)
+{
+  ++g_pairs;
+  if (lossDb <= maxLossDb)
+    {
+      ++g_reached;
+    }
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t nSites = 19;
+  uint32_t uesPerCell = 5;
+  double interSiteDistance = 500;
+  double maxLossDb = 110;
+  std::string channelType = "ns3::MultiModelSpectrumChannel";
+  double duration = 0.2;
+
+  CommandLine cmd;
+  cmd.AddValue ("nSites", "Number of macro sites of three sectors", nSites);
+  cmd.AddValue ("uesPerCell", "Number of UEs per cell", uesPerCell);
+  cmd.AddValue ("interSiteDistance", "Distance between the sites (m)", interSiteDistance);
+  cmd.AddValue ("maxLossDb", "Path loss (dB) beyond which the receivers are not reached", maxLossDb);
+  cmd.AddValue ("channelType", "TypeId name of the spectrum channels", channelType);
+  cmd.AddValue ("duration", "Simulated time (s)", duration);
+  cmd.Parse (argc, argv);
+
+  Ptr<LteHelper> lteHelper = CreateObject<LteHelper> ();
+  lteHelper->SetSpectrumChannelType (channelType);
+  lteHelper->SetSpectrumChannelAttribute ("MaxLossDb", DoubleValue (maxLossDb));
+
+  NodeContainer enbNodes;
+  enbNodes.Create (3 * nSites);
+  NodeContainer ueNodes;
+  ueNodes.Create (3 * nSites * uesPerCell);
+
+  MobilityHelper mobility;
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.Install (enbNodes);
+  Ptr<LteHexGridEnbTopologyHelper> topologyHelper = CreateObject<LteHexGridEnbTopologyHelper> ();
+  topologyHelper->SetLteHelper (lteHelper);
+  topologyHelper->SetAttribute ("InterSiteDistance", DoubleValue (interSiteDistance));
+  topologyHelper->SetAttribute ("MinX", DoubleValue (interSiteDistance / 2));
+  topologyHelper->SetAttribute ("GridWidth", UintegerValue (std::max (1u, (uint32_t) std::sqrt (nSites))));
+  lteHelper->SetEnbAntennaModelType ("ns3::ParabolicAntennaModel");
+  lteHelper->SetEnbAntennaModelAttribute ("Beamwidth", DoubleValue (70));
+  lteHelper->SetEnbAntennaModelAttribute ("MaxAttenuation", DoubleValue (20.0));
+  NetDeviceContainer enbDevs = topologyHelper->SetPositionAndInstallEnbDevice (enbNodes);
+
+  // drop the UEs over the bounding box of the sites
+  double xMax = 0;
+  double yMax = 0;
+  for (uint32_t i = 0; i < enbNodes.GetN (); ++i)
+    {
+      Vector position = enbNodes.Get (i)->GetObject<MobilityModel> ()->GetPosition ();
+      xMax = std::max (xMax, position.x + interSiteDistance / 2);
+      yMax = std::max (yMax, position.y + interSiteDistance / 2);
+    }
+  Ptr<UniformRandomVariable> xVar = CreateObject<UniformRandomVariable> ();
+  xVar->SetAttribute ("Max", DoubleValue (xMax));
+  xVar->SetStream (1);
+  Ptr<UniformRandomVariable> yVar = CreateObject<UniformRandomVariable> ();
+  yVar->SetAttribute ("Min", DoubleValue (-interSiteDistance / 2));
+  yVar->SetAttribute ("Max", DoubleValue (yMax));
+  yVar->SetStream (2);
+  Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator> ();
+  for (uint32_t i = 0; i < ueNodes.GetN (); ++i)
+    {
+      positionAlloc->Add (Vector (xVar->GetValue (), yVar->GetValue (), 1.5));
+    }
+  mobility.SetPositionAllocator (positionAlloc);
+  mobility.Install (ueNodes);
+  NetDeviceContainer ueDevs = lteHelper->InstallUeDevice (ueNodes);
+  lteHelper->AssignStreams (enbDevs, 100);
+  lteHelper->AssignStreams (ueDevs, 1000);
+
+  // without an EPC, the data radio bearers use RLC SM, which saturates
+  // the downlink and the uplink
+  lteHelper->AttachToClosestEnb (ueDevs, enbDevs);
+  lteHelper->ActivateDataRadioBearer (ueDevs, EpsBearer (EpsBearer::NGBR_VIDEO_TCP_DEFAULT));
+
+  Config::ConnectWithoutContext ("/NodeList/*/DeviceList/*/ComponentCarrierMapUe/*/LteUePhy/ReportCurrentCellRsrpSinr",
+                                 MakeCallback (&ReportRsrpSinr));
+  lteHelper->GetDownlinkSpectrumChannel ()->TraceConnectWithoutContext ("PathLoss",
+                                                                       MakeBoundCallback (&PathLoss, maxLossDb));
+  lteHelper->GetUplinkSpectrumChannel ()->TraceConnectWithoutContext ("PathLoss",
+                                                                     MakeBoundCallback (&PathLoss, maxLossDb));
+
+  Simulator::Stop (Seconds (duration));
+  SystemWallClockMs clock;
+  clock.Start ();
+  Simulator::Run ();
+  int64_t ms = clock.End ();
+  Simulator::Destroy ();
+
+  std::cout << 3 * nSites << " cells, " << ueNodes.GetN () << " UEs, " << channelType << std::endl;
+  std::cout << "time (ms)      " << ms << std::endl;
+  std::cout << "pairs          " << g_pairs << std::endl;
+  std::cout << "reached        " << g_reached << std::endl;
+  std::cout << "sum of RSRP    " << std::setprecision (12) << g_rsrpSum << std::endl;
+  return 0;
+}
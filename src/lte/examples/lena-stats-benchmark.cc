@@ -0,0 +1,132 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011 Centre Tecnologic de Telecomunicacions de Catalunya (CTTC)
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program measures the throughput of the LTE statistics output,
+// comparing the buffered LteStatsFileWriter used by PhyStatsCalculator,
+// in Text and Binary output format, against reopening the file in append
+// mode for every row, which is what the calculators used to do.
+// Sample usage:  ./waf --run 'lena-stats-benchmark --n=100000'
+
+#include "ns3/core-module.h"
+#include "ns3/lte-module.h"
+#include "ns3/system-wall-clock-ms.h"
+#include <fstream>
+#include <iostream>
+#include <cstdio>
+
+using namespace ns3;
+
+/**
+ * Write n RSRP/SINR rows, reopening the file for each of them.
+ *
+ * \param filename the output file
+ * \param n the number of rows
+ */
+static void
+WriteReopenPerRow (std::string filename, uint32_t n)
+{
+  for (uint32_t i = 0; i < n; ++i)
+    {
+      std::ofstream outFile;
+      if (i == 0)
+        {
+          outFile.open (filename.c_str ());
+          outFile << "% time\tcellId\tIMSI\tRNTI\trsrp\tsinr\tComponentCarrierId";
+          outFile << std::endl;
+        }
+      else
+        {
+          outFile.open (filename.c_str (), std::ios_base::app);
+        }
+      outFile << Simulator::Now ().GetNanoSeconds () / (double) 1e9 << "\t";
+      outFile << 1 << "\t";
+      outFile << (i % 64) + 1 << "\t";
+      outFile << (i % 64) + 1 << "\t";
+      outFile << 1.5e-12 * (i % 100) << "\t";
+      outFile << 12.25 + (i % 10) << "\t";
+      outFile << 0 << std::endl;
+      outFile.close ();
+    }
+}
+
+/**
+ * Write n RSRP/SINR rows through a PhyStatsCalculator.
+ *
+ * \param filename the output file
+ * \param n the number of rows
+ * \param format the output format of the calculator
+ */
+static void
+WriteBuffered (std::string filename, uint32_t n, LteStatsFileWriter::Format format)
+{
+  Ptr<PhyStatsCalculator> phyStats = CreateObject<PhyStatsCalculator> ();
+  phyStats->SetAttribute ("OutputFormat", EnumValue (format));
+  phyStats->SetCurrentCellRsrpSinrFilename (filename);
+  for (uint32_t i = 0; i < n; ++i)
+    {
+      phyStats->ReportCurrentCellRsrpSinr (1, (i % 64) + 1, (i % 64) + 1,
+                                           1.5e-12 * (i % 100), 12.25 + (i % 10), 0);
+    }
+  // flush and close, as done at the end of the simulation
+  Simulator::Destroy ();
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t n = 100000;
+  uint32_t bufferSize = LteStatsFileWriter::GetBufferSize ();
+  std::string filename = "lena-stats-benchmark.txt";
+  bool keep = false;
+
+  CommandLine cmd;
+  cmd.AddValue ("n", "Number of rows to write", n);
+  cmd.AddValue ("bufferSize", "Size in bytes of the buffer of each statistics file", bufferSize);
+  cmd.AddValue ("filename", "Name of the temporary output file", filename);
+  cmd.AddValue ("keep", "Do not remove the output file at the end", keep);
+  cmd.Parse (argc, argv);
+
+  LteStatsFileWriter::SetBufferSize (bufferSize);
+
+  SystemWallClockMs clock;
+  clock.Start ();
+  WriteReopenPerRow (filename, n);
+  int64_t reopenMs = clock.End ();
+
+  clock.Start ();
+  WriteBuffered (filename, n, LteStatsFileWriter::TEXT);
+  int64_t bufferedMs = clock.End ();
+
+  clock.Start ();
+  WriteBuffered (filename, n, LteStatsFileWriter::BINARY);
+  int64_t binaryMs = clock.End ();
+
+  std::cout << "rows=" << n << " bufferSize=" << bufferSize << std::endl;
+  std::cout << "reopen per row: " << reopenMs << " ms, "
+            << (reopenMs > 0 ? n * 1000.0 / reopenMs : 0) << " rows/s" << std::endl;
+  std::cout << "buffered:       " << bufferedMs << " ms, "
+            << (bufferedMs > 0 ? n * 1000.0 / bufferedMs : 0) << " rows/s" << std::endl;
+  std::cout << "binary:         " << binaryMs << " ms, "
+            << (binaryMs > 0 ? n * 1000.0 / binaryMs : 0) << " rows/s" << std::endl;
+
+  if (!keep)
+    {
+      std::remove (filename.c_str ());
+    }
+  return 0;
+}
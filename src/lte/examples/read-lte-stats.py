@@ -0,0 +1,150 @@
+#!/usr/bin/env python
+#
+# This program is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License version 2 as
+# published by the Free Software Foundation;
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; if not, write to the Free Software
+# Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+"""
+Reader of the LTE statistics files written with
+ns3::LteStatsCalculator::OutputFormat set to Binary (see the documentation
+of ns3::LteStatsFileWriter for the file format).
+
+Used as a program, it prints a binary statistics file in the same tab
+separated format used by the Text output format:
+
+    python read-lte-stats.py DlRsrpSinrStats.bin > DlRsrpSinrStats.txt
+
+Used as a module, read_lte_stats () returns the column names and the
+rows; when numpy is available and the file has no list column,
+read_lte_stats_numpy () returns a numpy structured array without any
+per-row parsing.
+"""
+
+from __future__ import print_function
+import struct
+import sys
+
+MAGIC = b'LTESTATS'
+BYTE_ORDER = 0x01020304
+VERSION = 1
+
+## struct format character of each column type
+TYPE_FORMATS = {
+    'f64': 'd',
+    'i64': 'q',
+    'u64': 'Q',
+    'u32': 'I',
+    'u16': 'H',
+    'u8': 'B',
+}
+
+
+def read_header(f):
+    """Read the header of a binary statistics file.
+    @param f file object opened in binary mode
+    @return (endianness prefix for struct, list of (name, type))
+    """
+    if f.read(8) != MAGIC:
+        raise ValueError('not a binary LTE statistics file')
+    raw = f.read(4)
+    if struct.unpack('<I', raw)[0] == BYTE_ORDER:
+        endian = '<'
+    elif struct.unpack('>I', raw)[0] == BYTE_ORDER:
+        endian = '>'
+    else:
+        raise ValueError('invalid byte order mark')
+    version, length = struct.unpack(endian + 'II', f.read(8))
+    if version != VERSION:
+        raise ValueError('unsupported format version %d' % version)
+    columns = []
+    for column in f.read(length).decode('ascii').split('\t'):
+        name, ctype = column.rsplit(':', 1)
+        if ctype != 'f64[]' and ctype not in TYPE_FORMATS:
+            raise ValueError('unknown column type ' + ctype)
+        columns.append((name, ctype))
+    return endian, columns
+
+
+def read_lte_stats(filename):
+    """Read all the rows of a binary statistics file.
+    @param filename name of the file
+    @return (list of column names, list of rows); the value of a f64[]
+            column is a list of floats
+    """
+    with open(filename, 'rb') as f:
+        endian, columns = read_header(f)
+        fixed = [c for c in columns if c[1] != 'f64[]']
+        has_list = len(fixed) != len(columns)
+        row_struct = struct.Struct(endian + ''.join(TYPE_FORMATS[t] for n, t in fixed))
+        count_struct = struct.Struct(endian + 'I')
+        data = f.read()
+    rows = []
+    offset = 0
+    while offset < len(data):
+        row = list(row_struct.unpack_from(data, offset))
+        offset += row_struct.size
+        if has_list:
+            n = count_struct.unpack_from(data, offset)[0]
+            offset += count_struct.size
+            row.append(list(struct.unpack_from(endian + '%dd' % n, data, offset)))
+            offset += 8 * n
+        rows.append(row)
+    return [n for n, t in columns], rows
+
+
+def read_lte_stats_numpy(filename):
+    """Read a binary statistics file without list columns as a numpy
+    structured array. Repeated column names get a numeric suffix.
+    @param filename name of the file
+    @return numpy structured array with one field per column
+    """
+    import numpy
+    with open(filename, 'rb') as f:
+        endian, columns = read_header(f)
+        offset = f.tell()
+    names = []
+    for name, ctype in columns:
+        if ctype == 'f64[]':
+            raise ValueError('list columns are not supported by read_lte_stats_numpy')
+        unique = name
+        suffix = 1
+        while unique in names:
+            suffix += 1
+            unique = '%s%d' % (name, suffix)
+        names.append(unique)
+    dtype = numpy.dtype([(n, endian + TYPE_FORMATS[t]) for n, (c, t) in zip(names, columns)])
+    return numpy.fromfile(filename, dtype=dtype, offset=offset)
+
+
+def format_value(value):
+    """Format a value like the default C++ ostream formatting."""
+    if isinstance(value, float):
+        return '%g' % value
+    if isinstance(value, list):
+        return ''.join('%g ' % v for v in value)
+    return str(value)
+
+
+def main(argv):
+    if len(argv) != 2:
+        print('usage: %s FILE' % argv[0], file=sys.stderr)
+        return 1
+    names, rows = read_lte_stats(argv[1])
+    out = sys.stdout
+    out.write('% ' + '\t'.join(names) + '\n')
+    for row in rows:
+        out.write('\t'.join(format_value(v) for v in row) + '\n')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
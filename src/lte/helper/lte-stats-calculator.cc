@@ -22,6 +22,7 @@
 
 #include <ns3/log.h>
 #include <ns3/config.h>
+#include <ns3/enum.h>
 #include <ns3/lte-enb-rrc.h>
 #include <ns3/lte-ue-rrc.h>
 #include <ns3/lte-enb-net-device.h>
@@ -35,7 +36,8 @@ NS_OBJECT_ENSURE_REGISTERED (LteStatsCalculator);
 
 LteStatsCalculator::LteStatsCalculator ()
   : m_dlOutputFilename (""),
-    m_ulOutputFilename ("")
+    m_ulOutputFilename (""),
+    m_outputFormat (LteStatsFileWriter::TEXT)
 {
   // Nothing to do here
 
@@ -54,10 +56,40 @@ LteStatsCalculator::GetTypeId (void)
     .SetParent<Object> ()
     .SetGroupName("Lte")
     .AddConstructor<LteStatsCalculator> ()
+    .AddAttribute ("OutputFormat",
+                   "Format of the output files: tab separated text, or fixed-width "
+                   "binary columns with a self-describing header (see LteStatsFileWriter).",
+                   EnumValue (LteStatsFileWriter::TEXT),
+                   MakeEnumAccessor (&LteStatsCalculator::m_outputFormat),
+                   MakeEnumChecker (LteStatsFileWriter::TEXT, "Text",
+                                    LteStatsFileWriter::BINARY, "Binary"))
   ;
   return tid;
 }
 
+void
+LteStatsCalculator::DoDispose ()
+{
+  m_writers.clear ();
+  Object::DoDispose ();
+}
+
+Ptr<LteStatsFileWriter>
+LteStatsCalculator::GetWriter (std::string filename, std::string columns)
+{
+  std::map<std::string, Ptr<LteStatsFileWriter> >::iterator it = m_writers.find (filename);
+  if (it != m_writers.end ())
+    {
+      return it->second;
+    }
+  Ptr<LteStatsFileWriter> writer = LteStatsFileWriter::Open (filename, columns, m_outputFormat);
+  if (writer != 0)
+    {
+      m_writers[filename] = writer;
+    }
+  return writer;
+}
+
 
 void
 LteStatsCalculator::SetUlOutputFilename (std::string outputFilename)
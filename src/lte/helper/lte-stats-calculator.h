@@ -23,6 +23,7 @@
 
 #include "ns3/object.h"
 #include "ns3/string.h"
+#include "ns3/lte-stats-file-writer.h"
 #include <map>
 
 namespace ns3 {
@@ -123,6 +124,16 @@ public:
   uint16_t GetCellIdPath (std::string path);
 
 protected:
+  virtual void DoDispose (void);
+
+  /**
+   * Get the writer of a statistics file, opening it in the format given
+   * by the OutputFormat attribute the first time it is requested.
+   * \param filename name of the statistics file
+   * \param columns column description, see LteStatsFileWriter
+   * \return the writer, or 0 if the file could not be opened
+   */
+  Ptr<LteStatsFileWriter> GetWriter (std::string filename, std::string columns);
 
   /**
    * Retrieves IMSI from Enb RLC path in the attribute system
@@ -204,6 +215,16 @@ private:
    * Name of the file where the uplink results will be saved
    */
   std::string m_ulOutputFilename;
+
+  /**
+   * Format of the output files
+   */
+  LteStatsFileWriter::Format m_outputFormat;
+
+  /**
+   * Writers of the output files, by file name
+   */
+  std::map<std::string, Ptr<LteStatsFileWriter> > m_writers;
 };
 
 } // namespace ns3
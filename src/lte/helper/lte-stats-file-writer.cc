@@ -0,0 +1,344 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011 Centre Tecnologic de Telecomunicacions de Catalunya (CTTC)
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "lte-stats-file-writer.h"
+
+#include <ns3/log.h>
+#include <ns3/assert.h>
+#include <ns3/abort.h>
+#include <ns3/simulator.h>
+#include <map>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("LteStatsFileWriter");
+
+namespace {
+
+/**
+ * The open statistics files, indexed by file name. The writers are owned
+ * by the calculators and remove themselves from the registry when they
+ * are destroyed.
+ */
+struct LteStatsFileRegistry
+{
+  LteStatsFileRegistry ()
+    : m_bufferSize (1 << 20),
+      m_flushScheduled (false)
+  {
+  }
+
+  std::map<std::string, LteStatsFileWriter *> m_writers; ///< open files
+  uint32_t m_bufferSize;  ///< buffer size given to each new file
+  bool m_flushScheduled;  ///< whether FlushAll is scheduled on Simulator::Destroy
+};
+
+LteStatsFileRegistry &
+GetRegistry (void)
+{
+  static LteStatsFileRegistry registry;
+  return registry;
+}
+
+/// Magic string at the beginning of a BINARY statistics file
+const char LTE_STATS_MAGIC[8] = { 'L', 'T', 'E', 'S', 'T', 'A', 'T', 'S' };
+
+/// Value used to detect the byte order of a BINARY statistics file
+const uint32_t LTE_STATS_BYTE_ORDER = 0x01020304;
+
+/// Version of the BINARY statistics file format
+const uint32_t LTE_STATS_VERSION = 1;
+
+} // unnamed namespace
+
+LteStatsFileWriter::LteStatsFileWriter (std::string filename, Format format)
+  : m_filename (filename),
+    m_format (format),
+    m_field (0)
+{
+  NS_LOG_FUNCTION (this << filename << format);
+  uint32_t bufferSize = GetRegistry ().m_bufferSize;
+  if (bufferSize > 0)
+    {
+      // the buffer must be installed before the file is opened
+      m_buffer.resize (bufferSize);
+      m_stream.rdbuf ()->pubsetbuf (&m_buffer[0], m_buffer.size ());
+    }
+  std::ios_base::openmode mode = std::ios_base::out | std::ios_base::trunc;
+  if (format == BINARY)
+    {
+      mode |= std::ios_base::binary;
+    }
+  m_stream.open (filename.c_str (), mode);
+}
+
+LteStatsFileWriter::~LteStatsFileWriter ()
+{
+  NS_LOG_FUNCTION (this);
+  LteStatsFileRegistry &registry = GetRegistry ();
+  std::map<std::string, LteStatsFileWriter *>::iterator it = registry.m_writers.find (m_filename);
+  if (it != registry.m_writers.end () && it->second == this)
+    {
+      registry.m_writers.erase (it);
+    }
+  m_stream.close ();
+}
+
+Ptr<LteStatsFileWriter>
+LteStatsFileWriter::Open (std::string filename, std::string columns, Format format)
+{
+  LteStatsFileRegistry &registry = GetRegistry ();
+  std::map<std::string, LteStatsFileWriter *>::iterator it = registry.m_writers.find (filename);
+  if (it != registry.m_writers.end ())
+    {
+      NS_ASSERT_MSG (it->second->m_format == format,
+                     "File " << filename << " already open with a different format");
+      return Ptr<LteStatsFileWriter> (it->second);
+    }
+
+  NS_LOG_FUNCTION (filename << columns << format);
+  Ptr<LteStatsFileWriter> writer (new LteStatsFileWriter (filename, format), false);
+  if (!writer->m_stream.is_open ())
+    {
+      NS_LOG_ERROR ("Can't open file " << filename.c_str ());
+      return 0;
+    }
+  writer->WriteHeader (columns);
+  registry.m_writers[filename] = PeekPointer (writer);
+
+  if (!registry.m_flushScheduled)
+    {
+      Simulator::ScheduleDestroy (&LteStatsFileWriter::FlushAll);
+      registry.m_flushScheduled = true;
+    }
+  return writer;
+}
+
+std::string
+LteStatsFileWriter::GetFilename (void) const
+{
+  return m_filename;
+}
+
+LteStatsFileWriter::Format
+LteStatsFileWriter::GetFormat (void) const
+{
+  return m_format;
+}
+
+void
+LteStatsFileWriter::WriteHeader (std::string columns)
+{
+  NS_LOG_FUNCTION (this << columns);
+  std::string textHeader = "%";
+  std::string::size_type start = 0;
+  while (start <= columns.size ())
+    {
+      std::string::size_type end = columns.find ('\t', start);
+      if (end == std::string::npos)
+        {
+          end = columns.size ();
+        }
+      std::string column = columns.substr (start, end - start);
+      std::string::size_type colon = column.rfind (':');
+      NS_ABORT_MSG_IF (colon == std::string::npos, "Column without type: " << column);
+      textHeader += (start == 0 ? " " : "\t") + column.substr (0, colon);
+      m_types.push_back (column.substr (colon + 1));
+      start = end + 1;
+    }
+
+  if (m_format == TEXT)
+    {
+      m_stream << textHeader << "\n";
+    }
+  else
+    {
+      m_stream.write (LTE_STATS_MAGIC, sizeof (LTE_STATS_MAGIC));
+      WriteRaw (LTE_STATS_BYTE_ORDER);
+      WriteRaw (LTE_STATS_VERSION);
+      WriteRaw (static_cast<uint32_t> (columns.size ()));
+      m_stream.write (columns.data (), columns.size ());
+    }
+}
+
+void
+LteStatsFileWriter::StartField (const char *type)
+{
+  NS_ASSERT_MSG (m_field < m_types.size (), "Too many fields in a row of " << m_filename);
+  NS_ASSERT_MSG (m_types[m_field] == type, "Field " << m_field << " of " << m_filename
+                 << " has type " << m_types[m_field] << ", not " << type);
+  if (m_format == TEXT && m_field > 0)
+    {
+      m_stream << "\t";
+    }
+  ++m_field;
+}
+
+void
+LteStatsFileWriter::Write (double value)
+{
+  StartField ("f64");
+  if (m_format == TEXT)
+    {
+      m_stream << value;
+    }
+  else
+    {
+      WriteRaw (value);
+    }
+}
+
+void
+LteStatsFileWriter::Write (int64_t value)
+{
+  StartField ("i64");
+  if (m_format == TEXT)
+    {
+      m_stream << value;
+    }
+  else
+    {
+      WriteRaw (value);
+    }
+}
+
+void
+LteStatsFileWriter::Write (uint64_t value)
+{
+  StartField ("u64");
+  if (m_format == TEXT)
+    {
+      m_stream << value;
+    }
+  else
+    {
+      WriteRaw (value);
+    }
+}
+
+void
+LteStatsFileWriter::Write (uint32_t value)
+{
+  StartField ("u32");
+  if (m_format == TEXT)
+    {
+      m_stream << value;
+    }
+  else
+    {
+      WriteRaw (value);
+    }
+}
+
+void
+LteStatsFileWriter::Write (uint16_t value)
+{
+  StartField ("u16");
+  if (m_format == TEXT)
+    {
+      m_stream << value;
+    }
+  else
+    {
+      WriteRaw (value);
+    }
+}
+
+void
+LteStatsFileWriter::Write (uint8_t value)
+{
+  StartField ("u8");
+  if (m_format == TEXT)
+    {
+      m_stream << (uint32_t) value;
+    }
+  else
+    {
+      WriteRaw (value);
+    }
+}
+
+void
+LteStatsFileWriter::Write (const SpectrumValue &value)
+{
+  StartField ("f64[]");
+  if (m_format == TEXT)
+    {
+      for (Values::const_iterator it = value.ConstValuesBegin ();
+           it != value.ConstValuesEnd (); ++it)
+        {
+          m_stream << *it << " ";
+        }
+    }
+  else
+    {
+      uint32_t n = value.ConstValuesEnd () - value.ConstValuesBegin ();
+      WriteRaw (n);
+      if (n > 0)
+        {
+          m_stream.write (reinterpret_cast<const char *> (&(*value.ConstValuesBegin ())),
+                          n * sizeof (double));
+        }
+    }
+}
+
+void
+LteStatsFileWriter::EndRow (void)
+{
+  NS_ASSERT_MSG (m_field == m_types.size (), "Missing fields in a row of " << m_filename);
+  if (m_format == TEXT)
+    {
+      m_stream << "\n";
+    }
+  m_field = 0;
+}
+
+void
+LteStatsFileWriter::Flush (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_stream.flush ();
+}
+
+void
+LteStatsFileWriter::FlushAll (void)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+  LteStatsFileRegistry &registry = GetRegistry ();
+  for (std::map<std::string, LteStatsFileWriter *>::iterator it = registry.m_writers.begin ();
+       it != registry.m_writers.end (); ++it)
+    {
+      it->second->Flush ();
+    }
+  registry.m_flushScheduled = false;
+}
+
+void
+LteStatsFileWriter::SetBufferSize (uint32_t bytes)
+{
+  NS_LOG_FUNCTION (bytes);
+  GetRegistry ().m_bufferSize = bytes;
+}
+
+uint32_t
+LteStatsFileWriter::GetBufferSize (void)
+{
+  return GetRegistry ().m_bufferSize;
+}
+
+} // namespace ns3
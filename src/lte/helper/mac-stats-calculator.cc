@@ -32,8 +32,6 @@ NS_LOG_COMPONENT_DEFINE ("MacStatsCalculator");
 NS_OBJECT_ENSURE_REGISTERED (MacStatsCalculator);
 
 MacStatsCalculator::MacStatsCalculator ()
-  : m_dlFirstWrite (true),
-    m_ulFirstWrite (true)
 {
   NS_LOG_FUNCTION (this);
 
@@ -96,41 +94,25 @@ MacStatsCalculator::DlScheduling (uint16_t cellId, uint64_t imsi, DlSchedulingCa
 		  dlSchedulingCallbackInfo.rnti << (uint32_t) dlSchedulingCallbackInfo.mcsTb1 << dlSchedulingCallbackInfo.sizeTb1 << (uint32_t) dlSchedulingCallbackInfo.mcsTb2 << dlSchedulingCallbackInfo.sizeTb2);
   NS_LOG_INFO ("Write DL Mac Stats in " << GetDlOutputFilename ().c_str ());
 
-  std::ofstream outFile;
-  if ( m_dlFirstWrite == true )
+  Ptr<LteStatsFileWriter> outFile = GetWriter (GetDlOutputFilename (),
+                                               "time:f64\tcellId:u16\tIMSI:u64\tframe:u32\tsframe:u32\tRNTI:u16\tmcsTb1:u8\tsizeTb1:u16\tmcsTb2:u8\tsizeTb2:u16\tccId:u8");
+  if (outFile == 0)
     {
-      outFile.open (GetDlOutputFilename ().c_str ());
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetDlOutputFilename ().c_str ());
-          return;
-        }
-      m_dlFirstWrite = false;
-      outFile << "% time\tcellId\tIMSI\tframe\tsframe\tRNTI\tmcsTb1\tsizeTb1\tmcsTb2\tsizeTb2\tccId";
-      outFile << std::endl;
-    }
-  else
-    {
-      outFile.open (GetDlOutputFilename ().c_str (),  std::ios_base::app);
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetDlOutputFilename ().c_str ());
-          return;
-        }
+      return;
     }
 
-  outFile << Simulator::Now ().GetNanoSeconds () / (double) 1e9 << "\t";
-  outFile << (uint32_t) cellId << "\t";
-  outFile << imsi << "\t";
-  outFile << dlSchedulingCallbackInfo.frameNo << "\t";
-  outFile << dlSchedulingCallbackInfo.subframeNo << "\t";
-  outFile << dlSchedulingCallbackInfo.rnti << "\t";
-  outFile << (uint32_t) dlSchedulingCallbackInfo.mcsTb1 << "\t";
-  outFile << dlSchedulingCallbackInfo.sizeTb1 << "\t";
-  outFile << (uint32_t) dlSchedulingCallbackInfo.mcsTb2 << "\t";
-  outFile << dlSchedulingCallbackInfo.sizeTb2 << "\t";
-  outFile << (uint32_t) dlSchedulingCallbackInfo.componentCarrierId << std::endl;
-  outFile.close ();
+  outFile->Write (Simulator::Now ().GetNanoSeconds () / (double) 1e9);
+  outFile->Write (cellId);
+  outFile->Write (imsi);
+  outFile->Write (dlSchedulingCallbackInfo.frameNo);
+  outFile->Write (dlSchedulingCallbackInfo.subframeNo);
+  outFile->Write (dlSchedulingCallbackInfo.rnti);
+  outFile->Write (dlSchedulingCallbackInfo.mcsTb1);
+  outFile->Write (dlSchedulingCallbackInfo.sizeTb1);
+  outFile->Write (dlSchedulingCallbackInfo.mcsTb2);
+  outFile->Write (dlSchedulingCallbackInfo.sizeTb2);
+  outFile->Write (dlSchedulingCallbackInfo.componentCarrierId);
+  outFile->EndRow ();
 }
 
 void
@@ -140,39 +122,23 @@ MacStatsCalculator::UlScheduling (uint16_t cellId, uint64_t imsi, uint32_t frame
   NS_LOG_FUNCTION (this << cellId << imsi << frameNo << subframeNo << rnti << (uint32_t) mcsTb << size);
   NS_LOG_INFO ("Write UL Mac Stats in " << GetUlOutputFilename ().c_str ());
 
-  std::ofstream outFile;
-  if ( m_ulFirstWrite == true )
-    {
-      outFile.open (GetUlOutputFilename ().c_str ());
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetUlOutputFilename ().c_str ());
-          return;
-        }
-      m_ulFirstWrite = false;
-      outFile << "% time\tcellId\tIMSI\tframe\tsframe\tRNTI\tmcs\tsize\tccId";
-      outFile << std::endl;
-    }
-  else
+  Ptr<LteStatsFileWriter> outFile = GetWriter (GetUlOutputFilename (),
+                                               "time:f64\tcellId:u16\tIMSI:u64\tframe:u32\tsframe:u32\tRNTI:u16\tmcs:u8\tsize:u16\tccId:u8");
+  if (outFile == 0)
     {
-      outFile.open (GetUlOutputFilename ().c_str (),  std::ios_base::app);
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetUlOutputFilename ().c_str ());
-          return;
-        }
+      return;
     }
 
-  outFile << Simulator::Now ().GetNanoSeconds () / (double) 1e9 << "\t";
-  outFile << (uint32_t) cellId << "\t";
-  outFile << imsi << "\t";
-  outFile << frameNo << "\t";
-  outFile << subframeNo << "\t";
-  outFile << rnti << "\t";
-  outFile << (uint32_t) mcsTb << "\t";
-  outFile << size << "\t";
-  outFile << (uint32_t) componentCarrierId << std::endl;
-  outFile.close ();
+  outFile->Write (Simulator::Now ().GetNanoSeconds () / (double) 1e9);
+  outFile->Write (cellId);
+  outFile->Write (imsi);
+  outFile->Write (frameNo);
+  outFile->Write (subframeNo);
+  outFile->Write (rnti);
+  outFile->Write (mcsTb);
+  outFile->Write (size);
+  outFile->Write (componentCarrierId);
+  outFile->EndRow ();
 }
 
 void
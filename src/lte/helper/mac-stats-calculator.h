@@ -149,23 +149,6 @@ public:
                              uint8_t mcs, uint16_t size, uint8_t componentCarrierId);
 
 
-private:
-  /**
-   * When writing DL MAC statistics first time to file,
-   * columns description is added. Then next lines are
-   * appended to file. This value is true if output
-   * files have not been opened yet
-   */
-  bool m_dlFirstWrite;
-
-  /**
-   * When writing UL MAC statistics first time to file,
-   * columns description is added. Then next lines are
-   * appended to file. This value is true if output
-   * files have not been opened yet
-   */
-  bool m_ulFirstWrite;
-
 };
 
 } // namespace ns3
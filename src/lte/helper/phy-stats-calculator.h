@@ -182,30 +182,6 @@ public:
 
 
 private:
-  /**
-   * When writing RSRP SINR statistics first time to file,
-   * columns description is added. Then next lines are
-   * appended to file. This value is true if output
-   * files have not been opened yet
-   */
-  bool m_RsrpSinrFirstWrite;
-
-  /**
-   * When writing UE SINR statistics first time to file,
-   * columns description is added. Then next lines are
-   * appended to file. This value is true if output
-   * files have not been opened yet
-   */
-  bool m_UeSinrFirstWrite;
-
-  /**
-   * When writing interference statistics first time to file,
-   * columns description is added. Then next lines are
-   * appended to file. This value is true if output
-   * files have not been opened yet
-   */
-  bool m_InterferenceFirstWrite;
-
   /**
    * Name of the file where the RSRP/SINR statistics will be saved
    */
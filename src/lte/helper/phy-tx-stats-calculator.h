@@ -126,23 +126,6 @@ public:
   static void UlPhyTransmissionCallback (Ptr<PhyTxStatsCalculator> phyTxStats,
                                   std::string path, PhyTransmissionStatParameters params);
 
-private:
-  /**
-   * When writing DL TX PHY statistics first time to file,
-   * columns description is added. Then next lines are
-   * appended to file. This value is true if output
-   * files have not been opened yet
-   */
-  bool m_dlTxFirstWrite;
-
-  /**
-   * When writing UL TX PHY statistics first time to file,
-   * columns description is added. Then next lines are
-   * appended to file. This value is true if output
-   * files have not been opened yet
-   */
-  bool m_ulTxFirstWrite;
-
 };
 
 } // namespace ns3
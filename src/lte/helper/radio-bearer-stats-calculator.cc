@@ -33,16 +33,14 @@ NS_LOG_COMPONENT_DEFINE ("RadioBearerStatsCalculator");
 NS_OBJECT_ENSURE_REGISTERED ( RadioBearerStatsCalculator);
 
 RadioBearerStatsCalculator::RadioBearerStatsCalculator ()
-  : m_firstWrite (true),
-    m_pendingOutput (false), 
+  : m_pendingOutput (false),
     m_protocolType ("RLC")
 {
   NS_LOG_FUNCTION (this);
 }
 
 RadioBearerStatsCalculator::RadioBearerStatsCalculator (std::string protocolType)
-  : m_firstWrite (true),
-    m_pendingOutput (false)
+  : m_pendingOutput (false)
 {
   NS_LOG_FUNCTION (this);
   m_protocolType = protocolType;
@@ -102,6 +100,7 @@ RadioBearerStatsCalculator::DoDispose ()
     {
       ShowResults ();
     }
+  LteStatsCalculator::DoDispose ();
 }
 
 void 
@@ -216,49 +215,16 @@ RadioBearerStatsCalculator::ShowResults (void)
   NS_LOG_FUNCTION (this << GetUlOutputFilename ().c_str () << GetDlOutputFilename ().c_str ());
   NS_LOG_INFO ("Write Rlc Stats in " << GetUlOutputFilename ().c_str () << " and in " << GetDlOutputFilename ().c_str ());
 
-  std::ofstream ulOutFile;
-  std::ofstream dlOutFile;
-
-  if (m_firstWrite == true)
-    {
-      ulOutFile.open (GetUlOutputFilename ().c_str ());
-      if (!ulOutFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetUlOutputFilename ().c_str ());
-          return;
-        }
-
-      dlOutFile.open (GetDlOutputFilename ().c_str ());
-      if (!dlOutFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetDlOutputFilename ().c_str ());
-          return;
-        }
-      m_firstWrite = false;
-      ulOutFile << "% start\tend\tCellId\tIMSI\tRNTI\tLCID\tnTxPDUs\tTxBytes\tnRxPDUs\tRxBytes\t";
-      ulOutFile << "delay\tstdDev\tmin\tmax\t";
-      ulOutFile << "PduSize\tstdDev\tmin\tmax";
-      ulOutFile << std::endl;
-      dlOutFile << "% start\tend\tCellId\tIMSI\tRNTI\tLCID\tnTxPDUs\tTxBytes\tnRxPDUs\tRxBytes\t";
-      dlOutFile << "delay\tstdDev\tmin\tmax\t";
-      dlOutFile << "PduSize\tstdDev\tmin\tmax";
-      dlOutFile << std::endl;
-    }
-  else
+  // the UL and DL files have the same columns
+  std::string columns = "start:f64\tend:f64\tCellId:u32\tIMSI:u64\tRNTI:u16\tLCID:u8\t"
+    "nTxPDUs:u32\tTxBytes:u64\tnRxPDUs:u32\tRxBytes:u64\t"
+    "delay:f64\tstdDev:f64\tmin:f64\tmax:f64\t"
+    "PduSize:f64\tstdDev:f64\tmin:f64\tmax:f64";
+  Ptr<LteStatsFileWriter> ulOutFile = GetWriter (GetUlOutputFilename (), columns);
+  Ptr<LteStatsFileWriter> dlOutFile = GetWriter (GetDlOutputFilename (), columns);
+  if (ulOutFile == 0 || dlOutFile == 0)
     {
-      ulOutFile.open (GetUlOutputFilename ().c_str (), std::ios_base::app);
-      if (!ulOutFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetUlOutputFilename ().c_str ());
-          return;
-        }
-
-      dlOutFile.open (GetDlOutputFilename ().c_str (), std::ios_base::app);
-      if (!dlOutFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetDlOutputFilename ().c_str ());
-          return;
-        }
+      return;
     }
 
   WriteUlResults (ulOutFile);
@@ -268,7 +234,7 @@ RadioBearerStatsCalculator::ShowResults (void)
 }
 
 void
-RadioBearerStatsCalculator::WriteUlResults (std::ofstream& outFile)
+RadioBearerStatsCalculator::WriteUlResults (Ptr<LteStatsFileWriter> outFile)
 {
   NS_LOG_FUNCTION (this);
 
@@ -302,34 +268,32 @@ RadioBearerStatsCalculator::WriteUlResults (std::ofstream& outFile)
       LteFlowId_t flowId = flowIdIt->second;
       NS_ASSERT_MSG (flowId.m_lcId == p.m_lcId, "lcid mismatch");
 
-      outFile << m_startTime.GetNanoSeconds () / 1.0e9 << "\t";
-      outFile << endTime.GetNanoSeconds () / 1.0e9 << "\t";
-      outFile << GetUlCellId (p.m_imsi, p.m_lcId) << "\t";
-      outFile << p.m_imsi << "\t";
-      outFile << flowId.m_rnti << "\t";
-      outFile << (uint32_t) flowId.m_lcId << "\t";
-      outFile << GetUlTxPackets (p.m_imsi, p.m_lcId) << "\t";
-      outFile << GetUlTxData (p.m_imsi, p.m_lcId) << "\t";
-      outFile << GetUlRxPackets (p.m_imsi, p.m_lcId) << "\t";
-      outFile << GetUlRxData (p.m_imsi, p.m_lcId) << "\t";
+      outFile->Write (m_startTime.GetNanoSeconds () / 1.0e9);
+      outFile->Write (endTime.GetNanoSeconds () / 1.0e9);
+      outFile->Write (GetUlCellId (p.m_imsi, p.m_lcId));
+      outFile->Write (p.m_imsi);
+      outFile->Write (flowId.m_rnti);
+      outFile->Write (flowId.m_lcId);
+      outFile->Write (GetUlTxPackets (p.m_imsi, p.m_lcId));
+      outFile->Write (GetUlTxData (p.m_imsi, p.m_lcId));
+      outFile->Write (GetUlRxPackets (p.m_imsi, p.m_lcId));
+      outFile->Write (GetUlRxData (p.m_imsi, p.m_lcId));
       std::vector<double> stats = GetUlDelayStats (p.m_imsi, p.m_lcId);
       for (std::vector<double>::iterator it = stats.begin (); it != stats.end (); ++it)
         {
-          outFile << (*it) * 1e-9 << "\t";
+          outFile->Write ((*it) * 1e-9);
         }
       stats = GetUlPduSizeStats (p.m_imsi, p.m_lcId);
       for (std::vector<double>::iterator it = stats.begin (); it != stats.end (); ++it)
         {
-          outFile << (*it) << "\t";
+          outFile->Write (*it);
         }
-      outFile << std::endl;
+      outFile->EndRow ();
     }
-
-  outFile.close ();
 }
 
 void
-RadioBearerStatsCalculator::WriteDlResults (std::ofstream& outFile)
+RadioBearerStatsCalculator::WriteDlResults (Ptr<LteStatsFileWriter> outFile)
 {
   NS_LOG_FUNCTION (this);
 
@@ -363,30 +327,28 @@ RadioBearerStatsCalculator::WriteDlResults (std::ofstream& outFile)
       LteFlowId_t flowId = flowIdIt->second;
       NS_ASSERT_MSG (flowId.m_lcId == p.m_lcId, "lcid mismatch");
 
-      outFile << m_startTime.GetNanoSeconds () / 1.0e9 << "\t";
-      outFile << endTime.GetNanoSeconds () / 1.0e9 << "\t";
-      outFile << GetDlCellId (p.m_imsi, p.m_lcId) << "\t";
-      outFile << p.m_imsi << "\t";
-      outFile << flowId.m_rnti << "\t";
-      outFile << (uint32_t) flowId.m_lcId << "\t";
-      outFile << GetDlTxPackets (p.m_imsi, p.m_lcId) << "\t";
-      outFile << GetDlTxData (p.m_imsi, p.m_lcId) << "\t";
-      outFile << GetDlRxPackets (p.m_imsi, p.m_lcId) << "\t";
-      outFile << GetDlRxData (p.m_imsi, p.m_lcId) << "\t";
+      outFile->Write (m_startTime.GetNanoSeconds () / 1.0e9);
+      outFile->Write (endTime.GetNanoSeconds () / 1.0e9);
+      outFile->Write (GetDlCellId (p.m_imsi, p.m_lcId));
+      outFile->Write (p.m_imsi);
+      outFile->Write (flowId.m_rnti);
+      outFile->Write (flowId.m_lcId);
+      outFile->Write (GetDlTxPackets (p.m_imsi, p.m_lcId));
+      outFile->Write (GetDlTxData (p.m_imsi, p.m_lcId));
+      outFile->Write (GetDlRxPackets (p.m_imsi, p.m_lcId));
+      outFile->Write (GetDlRxData (p.m_imsi, p.m_lcId));
       std::vector<double> stats = GetDlDelayStats (p.m_imsi, p.m_lcId);
       for (std::vector<double>::iterator it = stats.begin (); it != stats.end (); ++it)
         {
-          outFile << (*it) * 1e-9 << "\t";
+          outFile->Write ((*it) * 1e-9);
         }
       stats = GetDlPduSizeStats (p.m_imsi, p.m_lcId);
       for (std::vector<double>::iterator it = stats.begin (); it != stats.end (); ++it)
         {
-          outFile << (*it) << "\t";
+          outFile->Write (*it);
         }
-      outFile << std::endl;
+      outFile->EndRow ();
     }
-
-  outFile.close ();
 }
 
 void
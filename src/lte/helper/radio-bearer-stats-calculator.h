@@ -353,26 +353,23 @@ private:
    * Called after each epoch to write collected
    * statistics to output files. During first call
    * it opens output files and write columns descriptions.
-   * During next calls it opens output files in append mode.
    */
   void
   ShowResults (void);
 
   /**
-   * Writes collected statistics to UL output file and
-   * closes UL output file.
-   * @param outFile ofstream for UL statistics
+   * Writes collected statistics to UL output file.
+   * @param outFile writer of the UL statistics file
    */
   void
-  WriteUlResults (std::ofstream& outFile);
+  WriteUlResults (Ptr<LteStatsFileWriter> outFile);
 
   /**
-   * Writes collected statistics to DL output file and
-   * closes DL output file.
-   * @param outFile ofstream for DL statistics
+   * Writes collected statistics to DL output file.
+   * @param outFile writer of the DL statistics file
    */
   void
-  WriteDlResults (std::ofstream& outFile);
+  WriteDlResults (Ptr<LteStatsFileWriter> outFile);
 
   /**
    * Erases collected statistics
@@ -423,11 +420,6 @@ private:
    */
   Time m_epochDuration;
 
-  /**
-   * true if output files have not been opened yet
-   */
-  bool m_firstWrite;
-
   /**
    * true if any output is pending
    */
@@ -0,0 +1,225 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011 Centre Tecnologic de Telecomunicacions de Catalunya (CTTC)
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <ns3/lte-fading-trace.h>
+#include <ns3/log.h>
+#include <ns3/abort.h>
+#include <fstream>
+#include <sstream>
+#include <iterator>
+#include <map>
+#include <cstdlib>
+#include <cstring>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("LteFadingTrace");
+
+namespace {
+
+/**
+ * The loaded traces, indexed by file name and size. The traces are owned
+ * by the fading models and remove themselves from the registry when they
+ * are destroyed.
+ */
+std::map<std::string, LteFadingTrace *> &
+GetRegistry (void)
+{
+  static std::map<std::string, LteFadingTrace *> registry;
+  return registry;
+}
+
+/// Magic string at the beginning of a binary fading trace
+const char LTE_FADING_MAGIC[8] = { 'L', 'T', 'E', 'F', 'A', 'D', 'N', 'G' };
+
+/// Value used to detect the byte order of a binary fading trace
+const uint32_t LTE_FADING_BYTE_ORDER = 0x01020304;
+
+/// Version of the binary fading trace format
+const uint32_t LTE_FADING_VERSION = 1;
+
+/// Header of a binary fading trace
+struct LteFadingHeader
+{
+  char magic[8];       ///< LTE_FADING_MAGIC
+  uint32_t byteOrder;  ///< LTE_FADING_BYTE_ORDER
+  uint32_t version;    ///< LTE_FADING_VERSION
+  uint32_t rbNum;      ///< number of RBs
+  uint32_t samplesNum; ///< number of samples per RB
+};
+
+} // unnamed namespace
+
+LteFadingTrace::LteFadingTrace (std::string filename, uint32_t rbNum, uint32_t samplesNum)
+  : m_filename (filename),
+    m_rbNum (rbNum),
+    m_samplesNum (samplesNum),
+    m_stride (samplesNum),
+    m_samples (0),
+    m_mapping (0),
+    m_mappingSize (0)
+{
+  NS_LOG_FUNCTION (this << filename << rbNum << samplesNum);
+  std::ostringstream key;
+  key << filename << ":" << rbNum << ":" << samplesNum;
+  m_key = key.str ();
+  if (!MapBinary ())
+    {
+      LoadAscii ();
+    }
+}
+
+LteFadingTrace::~LteFadingTrace ()
+{
+  NS_LOG_FUNCTION (this);
+  std::map<std::string, LteFadingTrace *> &registry = GetRegistry ();
+  std::map<std::string, LteFadingTrace *>::iterator it = registry.find (m_key);
+  if (it != registry.end () && it->second == this)
+    {
+      registry.erase (it);
+    }
+  if (m_mapping != 0)
+    {
+      munmap (m_mapping, m_mappingSize);
+    }
+}
+
+Ptr<const LteFadingTrace>
+LteFadingTrace::Get (std::string filename, uint32_t rbNum, uint32_t samplesNum)
+{
+  std::ostringstream key;
+  key << filename << ":" << rbNum << ":" << samplesNum;
+  std::map<std::string, LteFadingTrace *> &registry = GetRegistry ();
+  std::map<std::string, LteFadingTrace *>::iterator it = registry.find (key.str ());
+  if (it != registry.end ())
+    {
+      NS_LOG_LOGIC ("sharing fading trace " << key.str ());
+      return Ptr<const LteFadingTrace> (it->second);
+    }
+  Ptr<LteFadingTrace> trace (new LteFadingTrace (filename, rbNum, samplesNum), false);
+  registry[key.str ()] = PeekPointer (trace);
+  return trace;
+}
+
+bool
+LteFadingTrace::MapBinary (void)
+{
+  NS_LOG_FUNCTION (this);
+  int fd = open (m_filename.c_str (), O_RDONLY);
+  NS_ASSERT_MSG (fd >= 0, " Fading trace file " << m_filename << " not found");
+  struct stat st;
+  LteFadingHeader header;
+  if (fstat (fd, &st) != 0
+      || st.st_size < (off_t) sizeof (header)
+      || read (fd, &header, sizeof (header)) != (ssize_t) sizeof (header)
+      || std::memcmp (header.magic, LTE_FADING_MAGIC, sizeof (LTE_FADING_MAGIC)) != 0)
+    {
+      close (fd);
+      return false;
+    }
+  NS_ABORT_MSG_IF (header.byteOrder != LTE_FADING_BYTE_ORDER,
+                   "Fading trace " << m_filename << " has a different byte order");
+  NS_ABORT_MSG_IF (header.version != LTE_FADING_VERSION,
+                   "Unsupported version " << header.version << " of fading trace " << m_filename);
+  NS_ABORT_MSG_IF (header.rbNum < m_rbNum || header.samplesNum < m_samplesNum,
+                   "Fading trace " << m_filename << " has " << header.rbNum << " RBs and "
+                   << header.samplesNum << " samples, " << m_rbNum << " RBs and "
+                   << m_samplesNum << " samples requested");
+  m_mappingSize = sizeof (header) + (size_t) header.rbNum * header.samplesNum * sizeof (double);
+  NS_ABORT_MSG_IF ((size_t) st.st_size < m_mappingSize, "Fading trace " << m_filename << " is truncated");
+  m_mapping = mmap (0, m_mappingSize, PROT_READ, MAP_SHARED, fd, 0);
+  close (fd);
+  NS_ABORT_MSG_IF (m_mapping == MAP_FAILED, "Can't map fading trace " << m_filename);
+  m_stride = header.samplesNum;
+  m_samples = reinterpret_cast<const double *> (static_cast<const char *> (m_mapping) + sizeof (header));
+  NS_LOG_INFO ("mapped binary fading trace " << m_filename);
+  return true;
+}
+
+void
+LteFadingTrace::LoadAscii (void)
+{
+  NS_LOG_FUNCTION (this);
+  std::ifstream ifTraceFile (m_filename.c_str ());
+  NS_ASSERT_MSG (ifTraceFile.good (), " Fading trace file " << m_filename << " not found");
+  std::string text ((std::istreambuf_iterator<char> (ifTraceFile)), std::istreambuf_iterator<char> ());
+
+  m_parsed.resize ((size_t) m_rbNum * m_samplesNum);
+  const char *cursor = text.c_str ();
+  for (size_t i = 0; i < m_parsed.size (); ++i)
+    {
+      char *end;
+      m_parsed[i] = std::strtod (cursor, &end);
+      NS_ABORT_MSG_IF (end == cursor, "Fading trace " << m_filename << " has only " << i
+                       << " samples, " << m_parsed.size () << " expected");
+      cursor = end;
+    }
+  m_samples = m_parsed.empty () ? 0 : &m_parsed[0];
+  NS_LOG_INFO ("parsed ASCII fading trace " << m_filename);
+}
+
+bool
+LteFadingTrace::ConvertToBinary (std::string asciiFilename, std::string binaryFilename,
+                                 uint32_t rbNum, uint32_t samplesNum)
+{
+  NS_LOG_FUNCTION (asciiFilename << binaryFilename << rbNum << samplesNum);
+  Ptr<const LteFadingTrace> trace = Get (asciiFilename, rbNum, samplesNum);
+  std::ofstream outFile (binaryFilename.c_str (), std::ios_base::out | std::ios_base::binary);
+  if (!outFile.is_open ())
+    {
+      NS_LOG_ERROR ("Can't open file " << binaryFilename.c_str ());
+      return false;
+    }
+  LteFadingHeader header;
+  std::memcpy (header.magic, LTE_FADING_MAGIC, sizeof (LTE_FADING_MAGIC));
+  header.byteOrder = LTE_FADING_BYTE_ORDER;
+  header.version = LTE_FADING_VERSION;
+  header.rbNum = rbNum;
+  header.samplesNum = samplesNum;
+  outFile.write (reinterpret_cast<const char *> (&header), sizeof (header));
+  for (uint32_t rb = 0; rb < rbNum; ++rb)
+    {
+      outFile.write (reinterpret_cast<const char *> (trace->m_samples + rb * trace->m_stride),
+                     samplesNum * sizeof (double));
+    }
+  return outFile.good ();
+}
+
+bool
+LteFadingTrace::IsMapped (void) const
+{
+  return m_mapping != 0;
+}
+
+uint32_t
+LteFadingTrace::GetRbNum (void) const
+{
+  return m_rbNum;
+}
+
+uint32_t
+LteFadingTrace::GetSamplesNum (void) const
+{
+  return m_samplesNum;
+}
+
+} // namespace ns3
@@ -32,8 +32,7 @@ NS_LOG_COMPONENT_DEFINE ("LteInterference");
 
 LteInterference::LteInterference ()
   : m_receiving (false),
-    m_lastSignalId (0),
-    m_lastSignalIdBeforeReset (0)
+    m_allSignalsValid (true)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -50,6 +49,8 @@ LteInterference::DoDispose ()
   m_rsPowerChunkProcessorList.clear ();
   m_sinrChunkProcessorList.clear ();
   m_interfChunkProcessorList.clear ();
+  m_expirationEvent.Cancel ();
+  m_signals.clear ();
   m_rxSignal = 0;
   m_allSignals = 0;
   m_noise = 0;
@@ -135,42 +136,115 @@ void
 LteInterference::AddSignal (Ptr<const SpectrumValue> spd, const Time duration)
 {
   NS_LOG_FUNCTION (this << *spd << duration);
-  DoAddSignal (spd);
-  uint32_t signalId = ++m_lastSignalId;
-  if (signalId == m_lastSignalIdBeforeReset)
+  DoAddSignal (spd, Now () + duration);
+}
+
+
+void
+LteInterference::DoAddSignal  (Ptr<const SpectrumValue> spd, Time endTime)
+{ 
+  NS_LOG_FUNCTION (this << *spd << endTime);
+  NS_ASSERT (spd->GetSpectrumModel () == m_allSignals->GetSpectrumModel ());
+  ConditionallyEvaluateChunk ();
+  Signal signal;
+  signal.psd = spd;
+  signal.endTime = endTime;
+  Values::const_iterator begin = spd->ConstValuesBegin ();
+  Values::const_iterator end = spd->ConstValuesEnd ();
+  Values::const_iterator first = begin;
+  while (first != end && *first == 0.0)
     {
-      // This happens when m_lastSignalId eventually wraps around. Given that so
-      // many signals have elapsed since the last reset, we hope that by now there is
-      // no stale pending signal (i.e., a signal that was scheduled
-      // for subtraction before the reset). So we just move the
-      // boundary further.
-      m_lastSignalIdBeforeReset += 0x10000000;
+      ++first;
     }
-  Simulator::Schedule (duration, &LteInterference::DoSubtractSignal, this, spd, signalId);
+  if (first == end)
+    {
+      NS_LOG_LOGIC ("ignoring a signal of zero power");
+      return;
+    }
+  Values::const_iterator last = end;
+  while (*(last - 1) == 0.0)
+    {
+      --last;
+    }
+  signal.firstRb = first - begin;
+  signal.endRb = last - begin;
+  m_signals.push_back (signal);
+  if (m_allSignalsValid)
+    {
+      AccumulateSignal (signal);
+    }
+  ScheduleExpiration ();
 }
 
+void
+LteInterference::AccumulateSignal (const Signal &signal)
+{
+  Values::iterator all = m_allSignals->ValuesBegin ();
+  Values::const_iterator psd = signal.psd->ConstValuesBegin ();
+  for (uint32_t rb = signal.firstRb; rb < signal.endRb; ++rb)
+    {
+      all[rb] += psd[rb];
+    }
+}
 
 void
-LteInterference::DoAddSignal  (Ptr<const SpectrumValue> spd)
-{ 
-  NS_LOG_FUNCTION (this << *spd);
+LteInterference::ExpireSignals ()
+{
+  NS_LOG_FUNCTION (this);
   ConditionallyEvaluateChunk ();
-  (*m_allSignals) += (*spd);
+  Time now = Now ();
+  std::vector<Signal>::iterator last = m_signals.begin ();
+  for (std::vector<Signal>::iterator it = m_signals.begin (); it != m_signals.end (); ++it)
+    {
+      if (it->endTime > now)
+        {
+          *last++ = *it;
+        }
+    }
+  NS_LOG_LOGIC (this << " " << m_signals.end () - last << " signals expired");
+  if (last != m_signals.end ())
+    {
+      m_signals.erase (last, m_signals.end ());
+      m_allSignalsValid = false;
+    }
+  ScheduleExpiration ();
 }
 
 void
-LteInterference::DoSubtractSignal  (Ptr<const SpectrumValue> spd, uint32_t signalId)
-{ 
-  NS_LOG_FUNCTION (this << *spd);
-  ConditionallyEvaluateChunk ();   
-  int32_t deltaSignalId = signalId - m_lastSignalIdBeforeReset;
-  if (deltaSignalId > 0)
-    {   
-      (*m_allSignals) -= (*spd);
+LteInterference::ScheduleExpiration ()
+{
+  if (m_signals.empty ())
+    {
+      return;
     }
-  else
+  Time endTime = m_signals.front ().endTime;
+  for (std::vector<Signal>::const_iterator it = m_signals.begin () + 1; it != m_signals.end (); ++it)
+    {
+      endTime = std::min (endTime, it->endTime);
+    }
+  if (m_expirationEvent.IsRunning ())
     {
-      NS_LOG_INFO ("ignoring signal scheduled for subtraction before last reset");
+      if (Simulator::GetDelayLeft (m_expirationEvent) <= endTime - Now ())
+        {
+          return;
+        }
+      m_expirationEvent.Cancel ();
+    }
+  m_expirationEvent = Simulator::Schedule (endTime - Now (), &LteInterference::ExpireSignals, this);
+}
+
+void
+LteInterference::UpdateAllSignals ()
+{
+  if (!m_allSignalsValid)
+    {
+      NS_LOG_LOGIC (this << " summing " << m_signals.size () << " signals");
+      (*m_allSignals) = 0.0;
+      for (std::vector<Signal>::const_iterator it = m_signals.begin (); it != m_signals.end (); ++it)
+        {
+          AccumulateSignal (*it);
+        }
+      m_allSignalsValid = true;
     }
 }
 
@@ -186,6 +260,7 @@ LteInterference::ConditionallyEvaluateChunk ()
   NS_LOG_DEBUG (this << " now "  << Now () << " last " << m_lastChangeTime);
   if (m_receiving && (Now () > m_lastChangeTime))
     {
+      UpdateAllSignals ();
       NS_LOG_LOGIC (this << " signal = " << *m_rxSignal << " allSignals = " << *m_allSignals << " noise = " << *m_noise);
 
       SpectrumValue interf =  (*m_allSignals) - (*m_rxSignal) + (*m_noise);
@@ -222,9 +297,10 @@ LteInterference::SetNoisePowerSpectralDensity (Ptr<const SpectrumValue> noisePsd
       // abort rx
       m_receiving = false;
     }
-  // record the last SignalId so that we can ignore all signals that
-  // were scheduled for subtraction before m_allSignal 
-  m_lastSignalIdBeforeReset = m_lastSignalId;
+  // forget the signals perceived before the reset
+  m_signals.clear ();
+  m_allSignalsValid = true;
+  m_expirationEvent.Cancel ();
 }
 
 void
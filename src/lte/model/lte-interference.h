@@ -25,9 +25,11 @@
 #include <ns3/object.h>
 #include <ns3/packet.h>
 #include <ns3/nstime.h>
+#include <ns3/event-id.h>
 #include <ns3/spectrum-value.h>
 
 #include <list>
+#include <vector>
 
 namespace ns3 {
 
@@ -42,6 +44,13 @@ class LteChunkProcessor;
  * This class implements a gaussian interference model, i.e., all
  * incoming signals are added to the total interference.
  *
+ * The signals being perceived are kept in a list, each with the range of
+ * RBs in which its PSD is not zero, so that adding a signal to the total
+ * only touches these RBs. The signals ending at the same time expire
+ * together, in a single event. The expired signals are not subtracted
+ * from the total, which would accumulate rounding errors: the total is
+ * computed again from the remaining signals when it is next needed, that
+ * is, when a chunk is evaluated.
  */
 class LteInterference : public Object
 {
@@ -126,15 +135,39 @@ private:
    * Add signal function
    *
    * @param spd the power spectral density of the new signal
+   * @param endTime the end time of the new signal
    */
-  void DoAddSignal  (Ptr<const SpectrumValue> spd);
+  void DoAddSignal  (Ptr<const SpectrumValue> spd, Time endTime);
   /**
-   * Subtract signal
+   * Remove the signals which ended, and schedule the next expiration.
+   */
+  void ExpireSignals ();
+  /**
+   * Schedule the expiration of the signals at the end time of the signal
+   * ending first, if it is not scheduled yet.
+   */
+  void ScheduleExpiration ();
+  /**
+   * Compute m_allSignals again from the signals being perceived, if
+   * signals were removed since it was last computed.
+   */
+  void UpdateAllSignals ();
+
+  /// A signal being perceived.
+  struct Signal
+  {
+    Ptr<const SpectrumValue> psd; ///< the power spectral density
+    uint32_t firstRb; ///< the first RB in which the PSD is not zero
+    uint32_t endRb;   ///< one past the last RB in which the PSD is not zero
+    Time endTime;     ///< the end time of the signal
+  };
+
+  /**
+   * Add a signal to m_allSignals, in the RBs of the signal only.
    *
-   * @param spd the power spectral density of the new signal
-   * @param signalId the signal ID
+   * @param signal the signal
    */
-  void DoSubtractSignal  (Ptr<const SpectrumValue> spd, uint32_t signalId);
+  void AccumulateSignal (const Signal &signal);
 
 
 
@@ -155,8 +188,12 @@ private:
   Time m_lastChangeTime;     /**< the time of the last change in
                                 m_TotalPower */
 
-  uint32_t m_lastSignalId; ///< the last signal ID
-  uint32_t m_lastSignalIdBeforeReset; ///< the last signal ID before reset
+  /// the signals being perceived, in order of arrival
+  std::vector<Signal> m_signals;
+  /// whether m_allSignals is the sum of m_signals
+  bool m_allSignalsValid;
+  /// the expiration of the signal ending first
+  EventId m_expirationEvent;
 
   /** all the processor instances that need to be notified whenever
   a new interference chunk is calculated */
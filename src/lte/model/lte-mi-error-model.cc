@@ -35,6 +35,7 @@
 #include <ns3/pointer.h>
 #include <stdint.h>
 #include <cmath>
+#include <algorithm>
 #include "stdlib.h"
 #include <ns3/lte-mi-error-model.h>
 
@@ -331,87 +332,176 @@ static const double cEcrTable [9][38] = {
 };
 
 
-double 
-LteMiErrorModel::Mib (const SpectrumValue& sinr, const std::vector<int>& map, uint8_t mcs)
+namespace {
+
+/// MI map of a modulation, with its SINR axis
+struct MiMap
 {
-  NS_LOG_FUNCTION (sinr << &map << (uint32_t) mcs);
-  
-  double MI;
-  double MIsum = 0.0;
-  SpectrumValue sinrCopy = sinr;
-  
-  for (uint32_t i = 0; i < map.size (); i++)
+  const double *mi;    ///< MI values
+  const double *axis;  ///< SINR values, uniformly spaced
+  uint16_t size;       ///< number of values
+  double scalingCoeff; ///< (size - 1) / (axis[size-1] - axis[0])
+};
+
+/**
+ * \param mcs the MCS
+ * \return the MI map of the modulation of the MCS
+ */
+const MiMap &
+GetMiMap (uint8_t mcs)
+{
+  static const MiMap qpsk = {
+    MI_map_qpsk, MI_map_qpsk_axis, MI_MAP_QPSK_SIZE,
+    (MI_MAP_QPSK_SIZE - 1) / (MI_map_qpsk_axis[MI_MAP_QPSK_SIZE-1] - MI_map_qpsk_axis[0])
+  };
+  static const MiMap qam16 = {
+    MI_map_16qam, MI_map_16qam_axis, MI_MAP_16QAM_SIZE,
+    (MI_MAP_16QAM_SIZE - 1) / (MI_map_16qam_axis[MI_MAP_16QAM_SIZE-1] - MI_map_16qam_axis[0])
+  };
+  static const MiMap qam64 = {
+    MI_map_64qam, MI_map_64qam_axis, MI_MAP_64QAM_SIZE,
+    (MI_MAP_64QAM_SIZE - 1) / (MI_map_64qam_axis[MI_MAP_64QAM_SIZE-1] - MI_map_64qam_axis[0])
+  };
+  if (mcs <= MI_QPSK_MAX_ID)
     {
-      double sinrLin = sinrCopy[map.at (i)];
-      if (mcs <= MI_QPSK_MAX_ID) // QPSK
-        {
+      return qpsk;
+    }
+  else if (mcs <= MI_16QAM_MAX_ID)
+    {
+      return qam16;
+    }
+  return qam64;
+}
 
-          if (sinrLin > MI_map_qpsk_axis[MI_MAP_QPSK_SIZE-1])
-            {
-              MI = 1;
-            }
-          else 
-            { 
-              // since the values in MI_map_qpsk_axis are uniformly spaced, we have
-              // index = ((sinrLin - value[0]) / (value[SIZE-1] - value[0])) * (SIZE-1)
-              // the scaling coefficient is always the same, so we use a static const
-              // to speed up the calculation
-              static const double scalingCoeffQpsk = 
-                (MI_MAP_QPSK_SIZE - 1) / (MI_map_qpsk_axis[MI_MAP_QPSK_SIZE-1] - MI_map_qpsk_axis[0]);
-              double sinrIndexDouble = (sinrLin -  MI_map_qpsk_axis[0]) * scalingCoeffQpsk + 1;
-              uint32_t sinrIndex = std::max(0.0, std::floor (sinrIndexDouble));
-              NS_ASSERT_MSG (sinrIndex < MI_MAP_QPSK_SIZE, "MI map out of data");
-              MI = MI_map_qpsk[sinrIndex];
-            }
-        }
-      else
+/**
+ * \param sinrLin the linear SINR of a RB
+ * \param map the MI map of the modulation
+ * \return the MI of the RB
+ */
+inline double
+GetMi (double sinrLin, const MiMap &map)
+{
+  // since the values in the axis are uniformly spaced, we have
+  // index = ((sinrLin - value[0]) / (value[SIZE-1] - value[0])) * (SIZE-1).
+  // The index is clamped instead of branching, so that the loops calling
+  // this function have a single select and can be vectorized.
+  double sinrIndexDouble = (sinrLin - map.axis[0]) * map.scalingCoeff + 1;
+  double sinrIndex = std::min (std::max (0.0, std::floor (sinrIndexDouble)), map.size - 1.0);
+  double mi = map.mi[static_cast<uint32_t> (sinrIndex)];
+  return sinrLin > map.axis[map.size - 1] ? 1.0 : mi;
+}
+
+/// Number of CB sizes with a BLER curve
+const int CB_MI_SIZES = 9;
+
+/// Number of ECRs with a BLER curve
+const int BLER_CURVES_ECRS = MI_64QAM_BLER_MAX_ID + 1;
+
+/// Parameters of the BLER curve of a (CB size, ECR)
+struct BlerCurve
+{
+  double b;     ///< b of the curve
+  double c;     ///< c of the curve
+  double scale; ///< 1 / (sqrt (2) * c)
+};
+
+/**
+ * \param cbIndex the index of the CB size in cbMiSizeTable
+ * \param ecrId the ECR index
+ * \return the BLER curve, with the missing parameters already replaced
+ *         by those of the lowest larger CB size including them
+ */
+const BlerCurve &
+GetBlerCurve (int cbIndex, uint8_t ecrId)
+{
+  static BlerCurve curves[CB_MI_SIZES][BLER_CURVES_ECRS];
+  static bool initialized = false;
+  if (!initialized)
+    {
+      for (int cb = 0; cb < CB_MI_SIZES; ++cb)
         {
-          if (mcs > MI_QPSK_MAX_ID && mcs <= MI_16QAM_MAX_ID )	// 16-QAM
-            {
-              if (sinrLin > MI_map_16qam_axis[MI_MAP_16QAM_SIZE-1])
-                {
-                  MI = 1;
-                }
-              else 
-                {
-                  // since the values in MI_map_16QAM_axis are uniformly spaced, we have
-                  // index = ((sinrLin - value[0]) / (value[SIZE-1] - value[0])) * (SIZE-1)
-                  // the scaling coefficient is always the same, so we use a static const
-                  // to speed up the calculation
-                  static const double scalingCoeff16qam = 
-                    (MI_MAP_16QAM_SIZE - 1) / (MI_map_16qam_axis[MI_MAP_16QAM_SIZE-1] - MI_map_16qam_axis[0]);
-                  double sinrIndexDouble = (sinrLin -  MI_map_16qam_axis[0]) * scalingCoeff16qam + 1;
-                  uint32_t sinrIndex = std::max(0.0, std::floor (sinrIndexDouble));
-                  NS_ASSERT_MSG (sinrIndex < MI_MAP_16QAM_SIZE, "MI map out of data");
-                  MI = MI_map_16qam[sinrIndex];
-                }
-            }
-          else // 64-QAM
+          for (int ecr = 0; ecr < BLER_CURVES_ECRS; ++ecr)
             {
-              if (sinrLin > MI_map_64qam_axis[MI_MAP_64QAM_SIZE-1])
+              double b = bEcrTable[cb][ecr];
+              for (int i = cb; (i < CB_MI_SIZES) && (b < 0); ++i)
                 {
-                  MI = 1;
+                  b = bEcrTable[i][ecr];
                 }
-              else
+              double c = cEcrTable[cb][ecr];
+              for (int i = cb; (i < CB_MI_SIZES) && (c < 0); ++i)
                 {
-                  // since the values in MI_map_64QAM_axis are uniformly spaced, we have
-                  // index = ((sinrLin - value[0]) / (value[SIZE-1] - value[0])) * (SIZE-1)
-                  // the scaling coefficient is always the same, so we use a static const
-                  // to speed up the calculation
-                  static const double scalingCoeff64qam = 
-                    (MI_MAP_64QAM_SIZE - 1) / (MI_map_64qam_axis[MI_MAP_64QAM_SIZE-1] - MI_map_64qam_axis[0]);
-                  double sinrIndexDouble = (sinrLin -  MI_map_64qam_axis[0]) * scalingCoeff64qam + 1;
-                  uint32_t sinrIndex = std::max(0.0, std::floor (sinrIndexDouble));
-                  NS_ASSERT_MSG (sinrIndex < MI_MAP_64QAM_SIZE, "MI map out of data");
-                  MI = MI_map_64qam[sinrIndex];
+                  c = cEcrTable[i][ecr];
                 }
+              curves[cb][ecr].b = b;
+              curves[cb][ecr].c = c;
+              curves[cb][ecr].scale = 1.0 / (sqrt (2) * c);
             }
         }
-      NS_LOG_LOGIC (" RB " << map.at (i) << "Minimum SNR = " << 10 * std::log10 (sinrLin) << " dB, " << sinrLin << " V, MCS = " << (uint16_t)mcs << ", MI = " << MI);
-      MIsum += MI;
+      initialized = true;
+    }
+  return curves[cbIndex][ecrId];
+}
+
+/// Number of intervals of the tabulated erf
+const uint32_t ERF_TABLE_INTERVALS = 8192;
+
+/// Range [-ERF_TABLE_MAX, ERF_TABLE_MAX] of the tabulated erf, |erf| = 1 outside
+const double ERF_TABLE_MAX = 6.0;
+
+/**
+ * \param x the argument
+ * \return erf (x), linearly interpolated from a precomputed table
+ *         (absolute error below 1e-6)
+ */
+double
+TabulatedErf (double x)
+{
+  static std::vector<double> table;
+  static const double step = 2 * ERF_TABLE_MAX / ERF_TABLE_INTERVALS;
+  if (table.empty ())
+    {
+      table.resize (ERF_TABLE_INTERVALS + 2);
+      for (uint32_t i = 0; i < table.size (); ++i)
+        {
+          table[i] = erf (-ERF_TABLE_MAX + i * step);
+        }
+    }
+  if (x <= -ERF_TABLE_MAX)
+    {
+      return -1.0;
+    }
+  if (x >= ERF_TABLE_MAX)
+    {
+      return 1.0;
     }
-  MI = MIsum / map.size ();
-  NS_LOG_LOGIC (" MI = " << MI);
+  double pos = (x + ERF_TABLE_MAX) / step;
+  uint32_t i = static_cast<uint32_t> (pos);
+  double frac = pos - i;
+  return table[i] + frac * (table[i + 1] - table[i]);
+}
+
+/// whether MappingMiBler uses the tabulated erf
+bool g_blerLookupEnabled = false;
+
+} // unnamed namespace
+
+double 
+LteMiErrorModel::Mib (const SpectrumValue& sinr, const std::vector<int>& map, uint8_t mcs)
+{
+  NS_LOG_FUNCTION (sinr << &map << (uint32_t) mcs);
+
+  // the modulation is selected once, and the RBs are then evaluated in
+  // a single pass over the SINR values, without copying them
+  const MiMap &miMap = GetMiMap (mcs);
+  const double *sinrValues = &(*sinr.ConstValuesBegin ());
+  double MIsum = 0.0;
+  for (uint32_t i = 0; i < map.size (); i++)
+    {
+      NS_ASSERT (map[i] >= 0 && sinr.ConstValuesBegin () + map[i] < sinr.ConstValuesEnd ());
+      MIsum += GetMi (sinrValues[map[i]], miMap);
+    }
+  double MI = MIsum / map.size ();
+  NS_LOG_LOGIC (" MCS = " << (uint16_t)mcs << ", RBs = " << map.size () << ", MI = " << MI);
   return MI;
 }
 
@@ -420,47 +510,47 @@ double
 LteMiErrorModel::MappingMiBler (double mib, uint8_t ecrId, uint16_t cbSize)
 {
   NS_LOG_FUNCTION (mib << (uint32_t) ecrId << (uint32_t) cbSize);
-  double b = 0;
-  double c = 0;
 
   NS_ASSERT_MSG (ecrId <= MI_64QAM_BLER_MAX_ID, "ECR out of range [0..37]: " << (uint16_t) ecrId);
   int cbIndex = 1;
-  while ((cbIndex < 9)&&(cbMiSizeTable[cbIndex]<= cbSize))
+  while ((cbIndex < CB_MI_SIZES)&&(cbMiSizeTable[cbIndex]<= cbSize))
     {
       cbIndex++;
     }
   cbIndex--;
   NS_LOG_LOGIC (" ECRid " << (uint16_t)ecrId << " ECR " << BlerCurvesEcrMap[ecrId] << " CB size " << cbSize << " CB size curve " << cbMiSizeTable[cbIndex]);
 
-  b = bEcrTable[cbIndex][ecrId];
-  if (b<0.0)
+  const BlerCurve &curve = GetBlerCurve (cbIndex, ecrId);
+  // see IEEE802.16m EMD formula 55 of section 4.3.2.1
+  double bler;
+  if (g_blerLookupEnabled)
     {
-      //take the lowest CB size including this CB for removing CB size
-      //quatization errors
-      int i = cbIndex;
-      while ((i<9)&&(b<0))
-        {
-          b = bEcrTable[i++][ecrId];
-        }
+      bler = 0.5*( 1 - TabulatedErf ((mib-curve.b)*curve.scale) );
     }
-  c = cEcrTable[cbIndex][ecrId];
-  if (c<0.0)
+  else
     {
-      //take the lowest CB size including this CB for removing CB size
-      //quatization errors
-      int i = cbIndex;
-      while ((i<9)&&(c<0))
-        {
-          c = cEcrTable[i++][ecrId];
-        }
+      bler = 0.5*( 1 - erf((mib-curve.b)/(sqrt(2)*curve.c)) );
     }
-  // see IEEE802.16m EMD formula 55 of section 4.3.2.1
-  double bler = 0.5*( 1 - erf((mib-b)/(sqrt(2)*c)) );
-  NS_LOG_LOGIC ("MIB: " << mib << " BLER:" << bler << " b:" << b << " c:" << c);
+  NS_LOG_LOGIC ("MIB: " << mib << " BLER:" << bler << " b:" << curve.b << " c:" << curve.c);
   return bler;
 }
 
 
+void
+LteMiErrorModel::SetBlerLookupEnabled (bool enabled)
+{
+  NS_LOG_FUNCTION (enabled);
+  g_blerLookupEnabled = enabled;
+}
+
+
+bool
+LteMiErrorModel::IsBlerLookupEnabled (void)
+{
+  return g_blerLookupEnabled;
+}
+
+
 
 double
 LteMiErrorModel::GetPcfichPdcchError (const SpectrumValue& sinr)
@@ -468,31 +558,13 @@ LteMiErrorModel::GetPcfichPdcchError (const SpectrumValue& sinr)
   NS_LOG_FUNCTION (sinr);
   double MI;
   double MIsum = 0.0;
-  SpectrumValue sinrCopy = sinr;
-  Values::iterator sinrIt = sinrCopy.ValuesBegin ();
+  const MiMap &qpsk = GetMiMap (0);
+  Values::const_iterator sinrIt = sinr.ConstValuesBegin ();
   uint16_t rb = 0;
-  NS_ASSERT (sinrIt!=sinrCopy.ValuesEnd ());
-  while (sinrIt!=sinrCopy.ValuesEnd ())
+  NS_ASSERT (sinrIt!=sinr.ConstValuesEnd ());
+  while (sinrIt!=sinr.ConstValuesEnd ())
     {
-      double sinrLin = *sinrIt;
-      if (sinrLin > MI_map_qpsk_axis[MI_MAP_QPSK_SIZE-1])
-        {
-          MI = 1;
-        }
-      else 
-        { 
-          // since the values in MI_map_qpsk_axis are uniformly spaced, we have
-          // index = ((sinrLin - value[0]) / (value[SIZE-1] - value[0])) * (SIZE-1)
-              // the scaling coefficient is always the same, so we use a static const
-              // to speed up the calculation
-          static const double scalingCoeffQpsk = 
-            (MI_MAP_QPSK_SIZE - 1) / (MI_map_qpsk_axis[MI_MAP_QPSK_SIZE-1] - MI_map_qpsk_axis[0]);
-          double sinrIndexDouble = (sinrLin -  MI_map_qpsk_axis[0]) * scalingCoeffQpsk + 1;
-          uint32_t sinrIndex = std::max(0.0, std::floor (sinrIndexDouble));
-          NS_ASSERT_MSG (sinrIndex < MI_MAP_QPSK_SIZE, "MI map out of data");
-          MI = MI_map_qpsk[sinrIndex];
-        }
-      MIsum += MI;
+      MIsum += GetMi (*sinrIt, qpsk);
       sinrIt++;
       rb++;
     }
@@ -554,7 +626,7 @@ LteMiErrorModel::GetPcfichPdcchError (const SpectrumValue& sinr)
 
 
 TbStats_t
-LteMiErrorModel::GetTbDecodificationStats (const SpectrumValue& sinr, const std::vector<int>& map, uint16_t size, uint8_t mcs, HarqProcessInfoList_t miHistory)
+LteMiErrorModel::GetTbDecodificationStats (const SpectrumValue& sinr, const std::vector<int>& map, uint16_t size, uint8_t mcs, const HarqProcessInfoList_t& miHistory)
 {
   NS_LOG_FUNCTION (sinr << &map << (uint32_t) size << (uint32_t) mcs);
 
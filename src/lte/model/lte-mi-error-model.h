@@ -85,6 +85,10 @@ public:
 
   /** 
    * \brief find the mmib (mean mutual information per bit) for different modulations of the specified TB
+   *
+   * The MI of all the RBs of the TB is evaluated in a single pass over
+   * the SINR values, without copying them.
+   *
    * \param sinr the perceived sinrs in the whole bandwidth
    * \param map the actives RBs for the TB
    * \param mcs the MCS of the TB
@@ -100,6 +104,23 @@ public:
    */
   static double MappingMiBler (double mib, uint8_t ecrId, uint16_t cbSize);
 
+  /**
+   * \brief enable or disable the BLER lookup table
+   *
+   * By default MappingMiBler evaluates the BLER curves with erf. When the
+   * lookup is enabled, erf is linearly interpolated from a precomputed
+   * table instead, which is faster but not bit-exact (the absolute error
+   * on the BLER is below 1e-6).
+   *
+   * \param enabled true to use the lookup table
+   */
+  static void SetBlerLookupEnabled (bool enabled);
+
+  /**
+   * \return true if the BLER lookup table is used
+   */
+  static bool IsBlerLookupEnabled (void);
+
   /**
    * \brief run the error-model algorithm for the specified TB
    * \param sinr the perceived sinrs in the whole bandwidth
@@ -109,7 +130,7 @@ public:
    * \param miHistory  MI of past transmissions (in case of retx)
    * \return the TB error rate and MI
    */
-  static TbStats_t GetTbDecodificationStats (const SpectrumValue& sinr, const std::vector<int>& map, uint16_t size, uint8_t mcs, HarqProcessInfoList_t miHistory);
+  static TbStats_t GetTbDecodificationStats (const SpectrumValue& sinr, const std::vector<int>& map, uint16_t size, uint8_t mcs, const HarqProcessInfoList_t& miHistory);
   
   /** 
   * \brief run the error-model algorithm for the specified PCFICH+PDCCH channels
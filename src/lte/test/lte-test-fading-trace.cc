@@ -0,0 +1,131 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011 Centre Tecnologic de Telecomunicacions de Catalunya (CTTC)
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/log.h"
+#include "ns3/lte-fading-trace.h"
+#include <fstream>
+#include <cstdio>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE ("LteTestFadingTrace");
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test that a fading trace converted to the binary format is
+ * memory-mapped and holds the same samples as the ASCII trace, and that a
+ * trace is loaded only once while it is in use.
+ */
+class LteFadingTraceTestCase : public TestCase
+{
+public:
+  LteFadingTraceTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \param rb the RB index
+   * \param sample the sample index
+   * \return the value written in the ASCII trace
+   */
+  static double Sample (uint32_t rb, uint32_t sample);
+};
+
+LteFadingTraceTestCase::LteFadingTraceTestCase ()
+  : TestCase ("ASCII and binary fading traces")
+{
+}
+
+double
+LteFadingTraceTestCase::Sample (uint32_t rb, uint32_t sample)
+{
+  return -0.125 * rb + 0.001 * sample - 3.5;
+}
+
+void
+LteFadingTraceTestCase::DoRun (void)
+{
+  const uint32_t rbNum = 6;
+  const uint32_t samplesNum = 50;
+  std::string asciiFile = CreateTempDirFilename ("lte-fading-trace.fad");
+  std::string binaryFile = CreateTempDirFilename ("lte-fading-trace.bin");
+
+  std::ofstream ascii (asciiFile.c_str ());
+  for (uint32_t rb = 0; rb < rbNum; ++rb)
+    {
+      for (uint32_t j = 0; j < samplesNum; ++j)
+        {
+          ascii << Sample (rb, j) << " ";
+        }
+      ascii << "\n";
+    }
+  ascii.close ();
+
+  Ptr<const LteFadingTrace> parsed = LteFadingTrace::Get (asciiFile, rbNum, samplesNum);
+  NS_TEST_ASSERT_MSG_EQ (parsed->IsMapped (), false, "ASCII trace should be parsed");
+  NS_TEST_ASSERT_MSG_EQ (LteFadingTrace::Get (asciiFile, rbNum, samplesNum), parsed,
+                         "ASCII trace loaded twice");
+
+  bool converted = LteFadingTrace::ConvertToBinary (asciiFile, binaryFile, rbNum, samplesNum);
+  NS_TEST_ASSERT_MSG_EQ (converted, true, "conversion failed");
+
+  // use fewer samples than the file has, as done with a shorter TraceLength
+  Ptr<const LteFadingTrace> mapped = LteFadingTrace::Get (binaryFile, rbNum - 1, samplesNum - 10);
+  NS_TEST_ASSERT_MSG_EQ (mapped->IsMapped (), true, "binary trace should be mapped");
+  NS_TEST_ASSERT_MSG_EQ (LteFadingTrace::Get (binaryFile, rbNum - 1, samplesNum - 10), mapped,
+                         "binary trace loaded twice");
+  for (uint32_t rb = 0; rb < rbNum - 1; ++rb)
+    {
+      for (uint32_t j = 0; j < samplesNum - 10; ++j)
+        {
+          NS_TEST_ASSERT_MSG_EQ (mapped->GetValue (rb, j), parsed->GetValue (rb, j),
+                                 "different sample (" << rb << ", " << j << ")");
+          NS_TEST_ASSERT_MSG_EQ_TOL (parsed->GetValue (rb, j), Sample (rb, j), 1e-9,
+                                     "wrong sample (" << rb << ", " << j << ")");
+        }
+    }
+
+  mapped = 0;
+  parsed = 0;
+  std::remove (asciiFile.c_str ());
+  std::remove (binaryFile.c_str ());
+}
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test suite for the loading of the fading traces.
+ */
+class LteFadingTraceTestSuite : public TestSuite
+{
+public:
+  LteFadingTraceTestSuite ();
+};
+
+static LteFadingTraceTestSuite g_lteFadingTraceTestSuite;
+
+LteFadingTraceTestSuite::LteFadingTraceTestSuite ()
+  : TestSuite ("lte-fading-trace", UNIT)
+{
+  AddTestCase (new LteFadingTraceTestCase, TestCase::QUICK);
+}
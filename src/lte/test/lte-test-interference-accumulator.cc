@@ -0,0 +1,172 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <ns3/log.h>
+#include <ns3/test.h>
+#include <ns3/simulator.h>
+#include <ns3/lte-interference.h>
+#include <ns3/lte-chunk-processor.h>
+#include <ns3/lte-spectrum-value-helper.h>
+#include <vector>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE ("LteInterferenceAccumulatorTest");
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * Chunk processor recording the chunks it evaluates.
+ */
+class LteRecordingChunkProcessor : public LteChunkProcessor
+{
+public:
+  virtual void EvaluateChunk (const SpectrumValue& value, Time duration)
+  {
+    m_values.push_back (value);
+    m_durations.push_back (duration);
+    LteChunkProcessor::EvaluateChunk (value, duration);
+  }
+
+  std::vector<SpectrumValue> m_values; //!< The values of the chunks.
+  std::vector<Time> m_durations;       //!< The durations of the chunks.
+};
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * Check the interference computed by LteInterference when signals of
+ * very different powers start and end during a reception: the
+ * interference after the end of a strong interferer must be exactly the
+ * one computed from the remaining signals, without the rounding errors of
+ * a subtraction. Also check that the signals perceived before a change
+ * of the noise PSD are forgotten.
+ */
+class LteInterferenceAccumulatorTestCase : public TestCase
+{
+public:
+  LteInterferenceAccumulatorTestCase ();
+  virtual ~LteInterferenceAccumulatorTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * Create a PSD of the test spectrum model.
+   * \param firstRb the first RB of the signal
+   * \param endRb one past the last RB of the signal
+   * \param value the PSD in the RBs of the signal
+   * \return the PSD
+   */
+  Ptr<SpectrumValue> CreatePsd (uint32_t firstRb, uint32_t endRb, double value);
+
+  Ptr<const SpectrumModel> m_model; //!< The spectrum model.
+};
+
+LteInterferenceAccumulatorTestCase::LteInterferenceAccumulatorTestCase ()
+  : TestCase ("Check the accumulation of the interference by LteInterference")
+{
+}
+
+LteInterferenceAccumulatorTestCase::~LteInterferenceAccumulatorTestCase ()
+{
+}
+
+Ptr<SpectrumValue>
+LteInterferenceAccumulatorTestCase::CreatePsd (uint32_t firstRb, uint32_t endRb, double value)
+{
+  Ptr<SpectrumValue> psd = Create<SpectrumValue> (m_model);
+  for (uint32_t rb = firstRb; rb < endRb; ++rb)
+    {
+      (*psd)[rb] = value * (1 + 0.1 * rb);
+    }
+  return psd;
+}
+
+void
+LteInterferenceAccumulatorTestCase::DoRun (void)
+{
+  m_model = LteSpectrumValueHelper::GetSpectrumModel (100, 6);
+  Ptr<SpectrumValue> noise = CreatePsd (0, 6, 1e-20);
+  Ptr<SpectrumValue> rx = CreatePsd (0, 3, 1e-13);
+  Ptr<SpectrumValue> weak = CreatePsd (2, 6, 3e-14);
+  Ptr<SpectrumValue> strong = CreatePsd (0, 6, 1e-3);
+  Ptr<SpectrumValue> zero = CreatePsd (0, 0, 0);
+  Ptr<SpectrumValue> later = CreatePsd (0, 6, 5e-14);
+  Ptr<SpectrumValue> rx2 = CreatePsd (1, 4, 2e-13);
+
+  Ptr<LteInterference> interference = CreateObject<LteInterference> ();
+  Ptr<LteRecordingChunkProcessor> processor = Create<LteRecordingChunkProcessor> ();
+  interference->AddInterferenceChunkProcessor (processor);
+  interference->SetNoisePowerSpectralDensity (noise);
+
+  // a reception of 1 ms with a weak interferer, and a strong interferer
+  // during the first 0.5 ms
+  Simulator::Schedule (MilliSeconds (1), &LteInterference::AddSignal, interference, rx, MilliSeconds (1));
+  Simulator::Schedule (MilliSeconds (1), &LteInterference::StartRx, interference, rx);
+  Simulator::Schedule (MilliSeconds (1), &LteInterference::AddSignal, interference, weak, MilliSeconds (1));
+  Simulator::Schedule (MilliSeconds (1), &LteInterference::AddSignal, interference, strong, MicroSeconds (500));
+  Simulator::Schedule (MilliSeconds (1), &LteInterference::AddSignal, interference, zero, MicroSeconds (700));
+  Simulator::Schedule (MilliSeconds (2), &LteInterference::EndRx, interference);
+  // a signal perceived before the noise PSD is set again, and a reception
+  // after it
+  Simulator::Schedule (MilliSeconds (3), &LteInterference::AddSignal, interference, later, MilliSeconds (1));
+  Simulator::Schedule (MicroSeconds (3500), &LteInterference::SetNoisePowerSpectralDensity, interference, noise);
+  Simulator::Schedule (MicroSeconds (3600), &LteInterference::AddSignal, interference, rx2, MicroSeconds (200));
+  Simulator::Schedule (MicroSeconds (3600), &LteInterference::StartRx, interference, rx2);
+  Simulator::Schedule (MicroSeconds (3800), &LteInterference::EndRx, interference);
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  NS_TEST_ASSERT_MSG_EQ (processor->m_values.size (), 3, "wrong number of chunks");
+  NS_TEST_ASSERT_MSG_EQ (processor->m_durations[0], MicroSeconds (500), "wrong duration of the first chunk");
+  NS_TEST_ASSERT_MSG_EQ (processor->m_durations[1], MicroSeconds (500), "wrong duration of the second chunk");
+  NS_TEST_ASSERT_MSG_EQ (processor->m_durations[2], MicroSeconds (200), "wrong duration of the third chunk");
+  for (uint32_t rb = 0; rb < 6; ++rb)
+    {
+      // the sums in the order of arrival of the signals
+      double all = ((0.0 + (*rx)[rb]) + (*weak)[rb]) + (*strong)[rb];
+      double expected = all - (*rx)[rb] + (*noise)[rb];
+      NS_TEST_ASSERT_MSG_EQ (processor->m_values[0][rb], expected, "wrong interference in RB " << rb << " with the strong interferer");
+      all = (0.0 + (*rx)[rb]) + (*weak)[rb];
+      expected = all - (*rx)[rb] + (*noise)[rb];
+      NS_TEST_ASSERT_MSG_EQ (processor->m_values[1][rb], expected, "wrong interference in RB " << rb << " after the strong interferer");
+      NS_TEST_ASSERT_MSG_EQ (processor->m_values[2][rb], (*noise)[rb], "wrong interference in RB " << rb << " after the reset");
+    }
+}
+
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * Test suite of the accumulation of the interference by LteInterference.
+ */
+class LteInterferenceAccumulatorTestSuite : public TestSuite
+{
+public:
+  LteInterferenceAccumulatorTestSuite ();
+};
+
+LteInterferenceAccumulatorTestSuite::LteInterferenceAccumulatorTestSuite ()
+  : TestSuite ("lte-interference-accumulator", UNIT)
+{
+  AddTestCase (new LteInterferenceAccumulatorTestCase, TestCase::QUICK);
+}
+
+static LteInterferenceAccumulatorTestSuite g_lteInterferenceAccumulatorTestSuite;
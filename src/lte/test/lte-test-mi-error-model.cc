@@ -0,0 +1,157 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011 Centre Tecnologic de Telecomunicacions de Catalunya (CTTC)
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/log.h"
+#include "ns3/lte-mi-error-model.h"
+#include "ns3/lte-spectrum-value-helper.h"
+#include <cmath>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE ("LteTestMiErrorModel");
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test that the MIB of a TB only depends on the SINR of its RBs and
+ * saturates at high SINR.
+ */
+class LteMiErrorModelMibTestCase : public TestCase
+{
+public:
+  LteMiErrorModelMibTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+LteMiErrorModelMibTestCase::LteMiErrorModelMibTestCase ()
+  : TestCase ("MIB of the RBs of a TB")
+{
+}
+
+void
+LteMiErrorModelMibTestCase::DoRun (void)
+{
+  Ptr<const SpectrumModel> model = LteSpectrumValueHelper::GetSpectrumModel (100, 25);
+  SpectrumValue sinr (model);
+  std::vector<int> low;
+  std::vector<int> high;
+  for (int i = 0; i < 25; ++i)
+    {
+      if (i % 2)
+        {
+          sinr[i] = 1e6;
+          high.push_back (i);
+        }
+      else
+        {
+          sinr[i] = 0.5;
+          low.push_back (i);
+        }
+    }
+
+  for (uint8_t mcs = 0; mcs <= MI_64QAM_MAX_ID; ++mcs)
+    {
+      double lowMib = LteMiErrorModel::Mib (sinr, low, mcs);
+      NS_TEST_ASSERT_MSG_EQ (LteMiErrorModel::Mib (sinr, high, mcs), 1.0,
+                             "MIB not saturated for MCS " << (uint32_t) mcs);
+      NS_TEST_ASSERT_MSG_GT (lowMib, 0.0, "null MIB for MCS " << (uint32_t) mcs);
+      NS_TEST_ASSERT_MSG_LT (lowMib, 1.0, "saturated MIB for MCS " << (uint32_t) mcs);
+
+      std::vector<int> all (low);
+      all.insert (all.end (), high.begin (), high.end ());
+      double expected = (lowMib * low.size () + high.size ()) / all.size ();
+      NS_TEST_ASSERT_MSG_EQ_TOL (LteMiErrorModel::Mib (sinr, all, mcs), expected, 1e-12,
+                                 "MIB is not the mean of the RBs for MCS " << (uint32_t) mcs);
+    }
+}
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test the accuracy of the BLER lookup table against the BLER curves
+ * evaluated with erf.
+ */
+class LteMiErrorModelBlerLookupTestCase : public TestCase
+{
+public:
+  LteMiErrorModelBlerLookupTestCase ();
+
+private:
+  virtual void DoRun (void);
+  virtual void DoTeardown (void);
+};
+
+LteMiErrorModelBlerLookupTestCase::LteMiErrorModelBlerLookupTestCase ()
+  : TestCase ("BLER lookup table accuracy")
+{
+}
+
+void
+LteMiErrorModelBlerLookupTestCase::DoRun (void)
+{
+  const uint16_t cbSizes[] = { 40, 100, 200, 500, 1000, 3000, 5000, 6144 };
+  double maxError = 0.0;
+  for (uint8_t ecrId = 0; ecrId <= MI_64QAM_BLER_MAX_ID; ++ecrId)
+    {
+      for (uint32_t cb = 0; cb < sizeof (cbSizes) / sizeof (cbSizes[0]); ++cb)
+        {
+          for (double mib = 0.0; mib <= 1.0; mib += 0.0007)
+            {
+              LteMiErrorModel::SetBlerLookupEnabled (false);
+              double exact = LteMiErrorModel::MappingMiBler (mib, ecrId, cbSizes[cb]);
+              LteMiErrorModel::SetBlerLookupEnabled (true);
+              double tabulated = LteMiErrorModel::MappingMiBler (mib, ecrId, cbSizes[cb]);
+              maxError = std::max (maxError, std::fabs (exact - tabulated));
+            }
+        }
+    }
+  NS_LOG_INFO ("maximum BLER error " << maxError);
+  NS_TEST_ASSERT_MSG_LT (maxError, 1e-6, "BLER lookup table not accurate enough");
+}
+
+void
+LteMiErrorModelBlerLookupTestCase::DoTeardown (void)
+{
+  LteMiErrorModel::SetBlerLookupEnabled (false);
+}
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test suite for the MI based error model.
+ */
+class LteMiErrorModelTestSuite : public TestSuite
+{
+public:
+  LteMiErrorModelTestSuite ();
+};
+
+static LteMiErrorModelTestSuite g_lteMiErrorModelTestSuite;
+
+LteMiErrorModelTestSuite::LteMiErrorModelTestSuite ()
+  : TestSuite ("lte-mi-error-model", UNIT)
+{
+  AddTestCase (new LteMiErrorModelMibTestCase, TestCase::QUICK);
+  AddTestCase (new LteMiErrorModelBlerLookupTestCase, TestCase::QUICK);
+}
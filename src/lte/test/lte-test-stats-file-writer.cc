@@ -0,0 +1,158 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011 Centre Tecnologic de Telecomunicacions de Catalunya (CTTC)
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/enum.h"
+#include "ns3/phy-stats-calculator.h"
+#include "ns3/lte-stats-file-writer.h"
+#include <fstream>
+#include <sstream>
+#include <cstring>
+#include <cstdio>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE ("LteTestStatsFileWriter");
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test that the RSRP/SINR statistics written by PhyStatsCalculator
+ * contain the same rows in Text and in Binary output format, and that the
+ * Binary header describes the columns.
+ */
+class LteStatsFileWriterTestCase : public TestCase
+{
+public:
+  LteStatsFileWriterTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * Write a few RSRP/SINR rows with a new PhyStatsCalculator.
+   * \param filename the output file
+   * \param format the output format
+   */
+  void WriteRows (std::string filename, LteStatsFileWriter::Format format);
+
+  /**
+   * Read a binary value from a stream.
+   * \param is the input stream
+   * \return the value
+   */
+  template <class T>
+  T Read (std::istream &is)
+  {
+    T value;
+    is.read (reinterpret_cast<char *> (&value), sizeof (T));
+    return value;
+  }
+};
+
+LteStatsFileWriterTestCase::LteStatsFileWriterTestCase ()
+  : TestCase ("Text and Binary LTE statistics output")
+{
+}
+
+void
+LteStatsFileWriterTestCase::WriteRows (std::string filename, LteStatsFileWriter::Format format)
+{
+  Ptr<PhyStatsCalculator> phyStats = CreateObject<PhyStatsCalculator> ();
+  phyStats->SetAttribute ("OutputFormat", EnumValue (format));
+  phyStats->SetCurrentCellRsrpSinrFilename (filename);
+  for (uint16_t i = 0; i < 3; ++i)
+    {
+      phyStats->ReportCurrentCellRsrpSinr (1, 10 + i, 20 + i, 0.5 * i, 0.25 + i, i % 2);
+    }
+  Simulator::Destroy ();
+}
+
+void
+LteStatsFileWriterTestCase::DoRun (void)
+{
+  std::string textFile = CreateTempDirFilename ("lte-stats-file-writer.txt");
+  std::string binaryFile = CreateTempDirFilename ("lte-stats-file-writer.bin");
+  WriteRows (textFile, LteStatsFileWriter::TEXT);
+  WriteRows (binaryFile, LteStatsFileWriter::BINARY);
+
+  std::ifstream text (textFile.c_str ());
+  NS_TEST_ASSERT_MSG_EQ (text.is_open (), true, "text file not written");
+  std::string line;
+  std::getline (text, line);
+  NS_TEST_ASSERT_MSG_EQ (line, "% time\tcellId\tIMSI\tRNTI\trsrp\tsinr\tComponentCarrierId",
+                         "wrong text header");
+  for (uint16_t i = 0; i < 3; ++i)
+    {
+      std::ostringstream expected;
+      expected << 0 << "\t" << 1 << "\t" << 10 + i << "\t" << 20 + i << "\t"
+               << 0.5 * i << "\t" << 0.25 + i << "\t" << i % 2;
+      std::getline (text, line);
+      NS_TEST_ASSERT_MSG_EQ (line, expected.str (), "wrong text row " << i);
+    }
+  NS_TEST_ASSERT_MSG_EQ (std::getline (text, line).eof (), true, "extra text rows");
+
+  std::ifstream binary (binaryFile.c_str (), std::ios_base::binary);
+  NS_TEST_ASSERT_MSG_EQ (binary.is_open (), true, "binary file not written");
+  char magic[8];
+  binary.read (magic, sizeof (magic));
+  NS_TEST_ASSERT_MSG_EQ (std::memcmp (magic, "LTESTATS", 8), 0, "wrong magic");
+  NS_TEST_ASSERT_MSG_EQ (Read<uint32_t> (binary), 0x01020304, "wrong byte order mark");
+  NS_TEST_ASSERT_MSG_EQ (Read<uint32_t> (binary), 1, "wrong version");
+  std::string columns (Read<uint32_t> (binary), '\0');
+  binary.read (&columns[0], columns.size ());
+  NS_TEST_ASSERT_MSG_EQ (columns, "time:f64\tcellId:u16\tIMSI:u64\tRNTI:u16\trsrp:f64\tsinr:f64\tComponentCarrierId:u8",
+                         "wrong column description");
+  for (uint16_t i = 0; i < 3; ++i)
+    {
+      NS_TEST_ASSERT_MSG_EQ (Read<double> (binary), 0, "wrong time in row " << i);
+      NS_TEST_ASSERT_MSG_EQ (Read<uint16_t> (binary), 1, "wrong cellId in row " << i);
+      NS_TEST_ASSERT_MSG_EQ (Read<uint64_t> (binary), 10 + i, "wrong IMSI in row " << i);
+      NS_TEST_ASSERT_MSG_EQ (Read<uint16_t> (binary), 20 + i, "wrong RNTI in row " << i);
+      NS_TEST_ASSERT_MSG_EQ (Read<double> (binary), 0.5 * i, "wrong rsrp in row " << i);
+      NS_TEST_ASSERT_MSG_EQ (Read<double> (binary), 0.25 + i, "wrong sinr in row " << i);
+      NS_TEST_ASSERT_MSG_EQ ((uint32_t) Read<uint8_t> (binary), i % 2, "wrong ccId in row " << i);
+    }
+  NS_TEST_ASSERT_MSG_EQ (binary.peek (), std::char_traits<char>::eof (), "extra binary rows");
+
+  std::remove (textFile.c_str ());
+  std::remove (binaryFile.c_str ());
+}
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test suite for the output formats of the LTE statistics files.
+ */
+class LteStatsFileWriterTestSuite : public TestSuite
+{
+public:
+  LteStatsFileWriterTestSuite ();
+};
+
+static LteStatsFileWriterTestSuite g_lteStatsFileWriterTestSuite;
+
+LteStatsFileWriterTestSuite::LteStatsFileWriterTestSuite ()
+  : TestSuite ("lte-stats-file-writer", UNIT)
+{
+  AddTestCase (new LteStatsFileWriterTestCase, TestCase::QUICK);
+}
@@ -53,6 +53,8 @@ MobilityModel::GetTypeId (void)
 }
 
 MobilityModel::MobilityModel ()
+  : m_epochPosition (Vector (0.0, 0.0, 0.0)),
+    m_positionEpoch (0)
 {
 }
 
@@ -91,9 +93,24 @@ MobilityModel::GetRelativeSpeed (Ptr<const MobilityModel> other) const
   return (GetVelocity () - other->GetVelocity ()).GetLength ();
 }
 
+uint32_t
+MobilityModel::GetPositionEpoch (void) const
+{
+  Vector position = DoGetPosition ();
+  if (position.x != m_epochPosition.x
+      || position.y != m_epochPosition.y
+      || position.z != m_epochPosition.z)
+    {
+      m_epochPosition = position;
+      ++m_positionEpoch;
+    }
+  return m_positionEpoch;
+}
+
 void
 MobilityModel::NotifyCourseChange (void) const
 {
+  ++m_positionEpoch;
   m_courseChangeTrace (this);
 }
 
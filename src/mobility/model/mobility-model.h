@@ -78,6 +78,20 @@ public:
    * \return the number of stream indices assigned by this model
    */
   int64_t AssignStreams (int64_t stream);
+  /**
+   * \brief Get the position epoch of the model.
+   *
+   * The epoch is a counter which changes whenever the position of the
+   * model may have changed: at each course change, and when the position
+   * sampled by this method differs from the position sampled by the
+   * previous call. Two calls returning the same epoch thus guarantee
+   * that the position did not change in between, which allows the
+   * users of the model to cache values depending only on the position,
+   * such as a propagation loss.
+   *
+   * \return the current position epoch
+   */
+  uint32_t GetPositionEpoch (void) const;
 
   /**
    *  TracedCallback signature.
@@ -129,6 +143,9 @@ private:
    */
   ns3::TracedCallback<Ptr<const MobilityModel> > m_courseChangeTrace;
 
+  mutable Vector m_epochPosition;  //!< The position sampled at the last epoch change.
+  mutable uint32_t m_positionEpoch; //!< The position epoch.
+
 };
 
 } // namespace ns3
@@ -0,0 +1,218 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "spatial-grid-index.h"
+#include "ns3/log.h"
+#include "ns3/assert.h"
+#include "ns3/callback.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("SpatialGridIndex");
+
+SpatialGridIndex::SpatialGridIndex ()
+  : m_cellSize (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+SpatialGridIndex::~SpatialGridIndex ()
+{
+  NS_LOG_FUNCTION (this);
+  Clear ();
+}
+
+void
+SpatialGridIndex::SetCellSize (double cellSize)
+{
+  NS_LOG_FUNCTION (this << cellSize);
+  NS_ASSERT (cellSize >= 0);
+  for (uint32_t id = 0; id < m_items.size (); ++id)
+    {
+      Remove (id);
+    }
+  m_cellSize = cellSize;
+  for (uint32_t id = 0; id < m_items.size (); ++id)
+    {
+      Insert (id);
+    }
+}
+
+double
+SpatialGridIndex::GetCellSize (void) const
+{
+  return m_cellSize;
+}
+
+uint32_t
+SpatialGridIndex::Add (Ptr<MobilityModel> mobility)
+{
+  NS_LOG_FUNCTION (this << mobility);
+  NS_ASSERT (mobility != 0);
+  uint32_t id = m_items.size ();
+  Item item;
+  item.mobility = mobility;
+  item.moving = false;
+  m_items.push_back (item);
+  std::vector<uint32_t> &ids = m_ids[PeekPointer (mobility)];
+  if (ids.empty ())
+    {
+      mobility->TraceConnectWithoutContext ("CourseChange",
+                                            MakeCallback (&SpatialGridIndex::CourseChanged, this));
+    }
+  ids.push_back (id);
+  Insert (id);
+  return id;
+}
+
+uint32_t
+SpatialGridIndex::GetN (void) const
+{
+  return m_items.size ();
+}
+
+Ptr<MobilityModel>
+SpatialGridIndex::Get (uint32_t id) const
+{
+  NS_ASSERT (id < m_items.size ());
+  return m_items[id].mobility;
+}
+
+void
+SpatialGridIndex::Clear (void)
+{
+  NS_LOG_FUNCTION (this);
+  for (std::map<const MobilityModel *, std::vector<uint32_t> >::iterator it = m_ids.begin ();
+       it != m_ids.end (); ++it)
+    {
+      m_items[it->second.front ()].mobility->TraceDisconnectWithoutContext (
+        "CourseChange", MakeCallback (&SpatialGridIndex::CourseChanged, this));
+    }
+  m_ids.clear ();
+  m_items.clear ();
+  m_cells.clear ();
+  m_moving.clear ();
+}
+
+int32_t
+SpatialGridIndex::GetCellCoordinate (double coordinate) const
+{
+  if (m_cellSize <= 0)
+    {
+      return 0;
+    }
+  double cell = std::floor (coordinate / m_cellSize);
+  cell = std::max (cell, (double) std::numeric_limits<int32_t>::min ());
+  cell = std::min (cell, (double) std::numeric_limits<int32_t>::max ());
+  return static_cast<int32_t> (cell);
+}
+
+void
+SpatialGridIndex::Insert (uint32_t id)
+{
+  Item &item = m_items[id];
+  if (item.mobility->GetVelocity ().GetLength () > 0)
+    {
+      item.moving = true;
+      m_moving.push_back (id);
+    }
+  else
+    {
+      Vector position = item.mobility->GetPosition ();
+      item.moving = false;
+      item.cell = CellKey (GetCellCoordinate (position.x), GetCellCoordinate (position.y));
+      m_cells[item.cell].push_back (id);
+    }
+}
+
+void
+SpatialGridIndex::Remove (uint32_t id)
+{
+  Item &item = m_items[id];
+  if (item.moving)
+    {
+      m_moving.erase (std::find (m_moving.begin (), m_moving.end (), id));
+    }
+  else
+    {
+      std::map<CellKey, std::vector<uint32_t> >::iterator cell = m_cells.find (item.cell);
+      NS_ASSERT (cell != m_cells.end ());
+      cell->second.erase (std::find (cell->second.begin (), cell->second.end (), id));
+      if (cell->second.empty ())
+        {
+          m_cells.erase (cell);
+        }
+    }
+}
+
+void
+SpatialGridIndex::CourseChanged (Ptr<const MobilityModel> mobility)
+{
+  NS_LOG_FUNCTION (this << mobility);
+  std::map<const MobilityModel *, std::vector<uint32_t> >::const_iterator it = m_ids.find (PeekPointer (mobility));
+  NS_ASSERT (it != m_ids.end ());
+  for (std::vector<uint32_t>::const_iterator id = it->second.begin (); id != it->second.end (); ++id)
+    {
+      Remove (*id);
+      Insert (*id);
+    }
+}
+
+void
+SpatialGridIndex::GetCandidates (const Vector &position, double range,
+                                 std::vector<uint32_t> &candidates) const
+{
+  NS_LOG_FUNCTION (this << position << range);
+  std::vector<uint32_t>::size_type first = candidates.size ();
+  int32_t xMin = GetCellCoordinate (position.x - range);
+  int32_t xMax = GetCellCoordinate (position.x + range);
+  int32_t yMin = GetCellCoordinate (position.y - range);
+  int32_t yMax = GetCellCoordinate (position.y + range);
+  double cellsInRange = (xMax - (double) xMin + 1) * (yMax - (double) yMin + 1);
+  if (cellsInRange <= m_cells.size ())
+    {
+      for (int32_t x = xMin; x <= xMax; ++x)
+        {
+          for (int32_t y = yMin; y <= yMax; ++y)
+            {
+              std::map<CellKey, std::vector<uint32_t> >::const_iterator cell = m_cells.find (CellKey (x, y));
+              if (cell != m_cells.end ())
+                {
+                  candidates.insert (candidates.end (), cell->second.begin (), cell->second.end ());
+                }
+            }
+        }
+    }
+  else
+    {
+      // the range covers more cells than the non-empty ones
+      for (std::map<CellKey, std::vector<uint32_t> >::const_iterator cell = m_cells.begin ();
+           cell != m_cells.end (); ++cell)
+        {
+          if (cell->first.first >= xMin && cell->first.first <= xMax
+              && cell->first.second >= yMin && cell->first.second <= yMax)
+            {
+              candidates.insert (candidates.end (), cell->second.begin (), cell->second.end ());
+            }
+        }
+    }
+  candidates.insert (candidates.end (), m_moving.begin (), m_moving.end ());
+  std::sort (candidates.begin () + first, candidates.end ());
+}
+
+} // namespace ns3
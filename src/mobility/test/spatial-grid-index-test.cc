@@ -0,0 +1,141 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/spatial-grid-index.h"
+#include "ns3/constant-position-mobility-model.h"
+#include "ns3/constant-velocity-mobility-model.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/rng-seed-manager.h"
+#include <algorithm>
+
+using namespace ns3;
+
+/**
+ * \ingroup mobility-test
+ * \ingroup tests
+ *
+ * \brief Check that the candidates returned by the spatial grid index
+ * include all the models within range, in increasing order, for several
+ * cell sizes and after some models moved.
+ */
+class SpatialGridIndexCandidatesTest : public TestCase
+{
+public:
+  SpatialGridIndexCandidatesTest ();
+
+private:
+  virtual void DoRun (void);
+  /**
+   * Check the candidates of random queries against the distances.
+   * \param index the index
+   * \param models the models in the index
+   */
+  void CheckQueries (const SpatialGridIndex &index,
+                     const std::vector<Ptr<MobilityModel> > &models);
+};
+
+SpatialGridIndexCandidatesTest::SpatialGridIndexCandidatesTest ()
+  : TestCase ("Check the candidates of the spatial grid index")
+{
+}
+
+void
+SpatialGridIndexCandidatesTest::CheckQueries (const SpatialGridIndex &index,
+                                              const std::vector<Ptr<MobilityModel> > &models)
+{
+  Ptr<UniformRandomVariable> random = CreateObject<UniformRandomVariable> ();
+  for (uint32_t query = 0; query < 50; ++query)
+    {
+      Vector position (random->GetValue (-100, 600), random->GetValue (-100, 600), 0);
+      double range = random->GetValue (0, 200);
+      std::vector<uint32_t> candidates;
+      index.GetCandidates (position, range, candidates);
+      NS_TEST_ASSERT_MSG_EQ (std::is_sorted (candidates.begin (), candidates.end ()), true,
+                             "candidates not sorted");
+      for (uint32_t id = 0; id < models.size (); ++id)
+        {
+          if (CalculateDistance (models[id]->GetPosition (), position) <= range)
+            {
+              NS_TEST_ASSERT_MSG_EQ (std::binary_search (candidates.begin (), candidates.end (), id), true,
+                                     "model " << id << " in range but not a candidate");
+            }
+        }
+    }
+}
+
+void
+SpatialGridIndexCandidatesTest::DoRun (void)
+{
+  RngSeedManager::SetSeed (1);
+  RngSeedManager::SetRun (1);
+  Ptr<UniformRandomVariable> random = CreateObject<UniformRandomVariable> ();
+  SpatialGridIndex index;
+  std::vector<Ptr<MobilityModel> > models;
+  for (uint32_t i = 0; i < 200; ++i)
+    {
+      Ptr<MobilityModel> model = CreateObject<ConstantPositionMobilityModel> ();
+      model->SetPosition (Vector (random->GetValue (0, 500), random->GetValue (0, 500), random->GetValue (0, 10)));
+      NS_TEST_ASSERT_MSG_EQ (index.Add (model), i, "unexpected identifier");
+      models.push_back (model);
+    }
+  Ptr<ConstantVelocityMobilityModel> moving = CreateObject<ConstantVelocityMobilityModel> ();
+  moving->SetPosition (Vector (250, 250, 0));
+  moving->SetVelocity (Vector (10, 0, 0));
+  index.Add (moving);
+  models.push_back (moving);
+  NS_TEST_ASSERT_MSG_EQ (index.GetN (), models.size (), "unexpected number of models");
+
+  const double cellSizes[] = { 0, 10, 100, 1000 };
+  for (uint32_t i = 0; i < sizeof (cellSizes) / sizeof (cellSizes[0]); ++i)
+    {
+      index.SetCellSize (cellSizes[i]);
+      CheckQueries (index, models);
+      // move some of the stationary models, through their CourseChange
+      for (uint32_t id = 0; id < 200; id += 7)
+        {
+          models[id]->SetPosition (Vector (random->GetValue (0, 500), random->GetValue (0, 500), 0));
+        }
+      CheckQueries (index, models);
+    }
+
+  // a model which stops is moved to a cell
+  index.SetCellSize (10);
+  moving->SetVelocity (Vector (0, 0, 0));
+  std::vector<uint32_t> candidates;
+  index.GetCandidates (Vector (0, 0, 0), 1, candidates);
+  NS_TEST_ASSERT_MSG_EQ (std::count (candidates.begin (), candidates.end (), 200), 0,
+                         "stopped model still returned as moving");
+
+  index.Clear ();
+  NS_TEST_ASSERT_MSG_EQ (index.GetN (), 0, "index not empty");
+  // the index is disconnected from the CourseChange trace sources
+  models[0]->SetPosition (Vector (0, 0, 0));
+}
+
+/**
+ * \ingroup mobility-test
+ * \ingroup tests
+ *
+ * \brief Spatial Grid Index Test Suite
+ */
+static struct SpatialGridIndexTestSuite : public TestSuite
+{
+  SpatialGridIndexTestSuite () : TestSuite ("spatial-grid-index", UNIT)
+  {
+    AddTestCase (new SpatialGridIndexCandidatesTest (), TestCase::QUICK);
+  }
+} g_spatialGridIndexTestSuite; ///< the test suite
@@ -26,6 +26,7 @@
 #include <ns3/net-device.h>
 #include <ns3/node.h>
 #include <ns3/double.h>
+#include <ns3/boolean.h>
 #include <ns3/mobility-model.h>
 #include <ns3/spectrum-phy.h>
 #include <ns3/spectrum-converter.h>
@@ -82,6 +83,7 @@ RxSpectrumModelInfo::RxSpectrumModelInfo (Ptr<const SpectrumModel> rxSpectrumMod
 
 
 MultiModelSpectrumChannel::MultiModelSpectrumChannel ()
+  : m_pathLossCacheModel (0)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -92,6 +94,7 @@ MultiModelSpectrumChannel::DoDispose ()
   NS_LOG_FUNCTION (this);
   m_txSpectrumModelInfoMap.clear ();
   m_rxSpectrumModelInfoMap.clear ();
+  m_pathLossCache.clear ();
   SpectrumChannel::DoDispose ();
 }
 
@@ -102,7 +105,14 @@ MultiModelSpectrumChannel::GetTypeId (void)
     .SetParent<SpectrumChannel> ()
     .SetGroupName ("Spectrum")
     .AddConstructor<MultiModelSpectrumChannel> ()
-
+    .AddAttribute ("EnablePathLossCache",
+                   "If true, the path loss of each pair of transmitter and receiver "
+                   "is cached until one of them moves. This must only be enabled "
+                   "when the PropagationLossModel is a deterministic function of "
+                   "the positions of the transmitter and of the receiver.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&MultiModelSpectrumChannel::m_pathLossCacheEnabled),
+                   MakeBooleanChecker ())
   ;
   return tid;
 }
@@ -245,6 +255,18 @@ MultiModelSpectrumChannel::StartTx (Ptr<SpectrumSignalParameters> txParams)
   NS_LOG_LOGIC ("converter map size: " << txInfoIteratorerator->second.m_spectrumConverterMap.size ());
   NS_LOG_LOGIC ("converter map first element: " << txInfoIteratorerator->second.m_spectrumConverterMap.begin ()->first);
 
+  uint32_t txEpoch = 0;
+  if (m_pathLossCacheEnabled && txMobility)
+    {
+      if (m_pathLossCacheModel != PeekPointer (m_propagationLoss))
+        {
+          NS_LOG_LOGIC ("propagation loss model changed, invalidating the path loss cache");
+          InvalidatePathLossCache ();
+          m_pathLossCacheModel = PeekPointer (m_propagationLoss);
+        }
+      txEpoch = txMobility->GetPositionEpoch ();
+    }
+
   for (RxSpectrumModelInfoMap_t::const_iterator rxInfoIterator = m_rxSpectrumModelInfoMap.begin ();
        rxInfoIterator != m_rxSpectrumModelInfoMap.end ();
        ++rxInfoIterator)
@@ -278,79 +300,115 @@ MultiModelSpectrumChannel::StartTx (Ptr<SpectrumSignalParameters> txParams)
           NS_ASSERT_MSG ((*rxPhyIterator)->GetRxSpectrumModel ()->GetUid () == rxSpectrumModelUid,
                          "SpectrumModel change was not notified to MultiModelSpectrumChannel (i.e., AddRx should be called again after model is changed)");
 
-          if ((*rxPhyIterator) != txParams->txPhy)
+          if ((*rxPhyIterator) == txParams->txPhy)
             {
-              NS_LOG_LOGIC (" copying signal parameters " << txParams);
-              Ptr<SpectrumSignalParameters> rxParams = txParams->Copy ();
-              rxParams->psd = Copy<SpectrumValue> (convertedTxPowerSpectrum);
-              Time delay = MicroSeconds (0);
-
-              Ptr<MobilityModel> receiverMobility = (*rxPhyIterator)->GetMobility ();
+              continue;
+            }
 
-              if (txMobility && receiverMobility)
+          // compute the scalar path loss first, so that the receivers
+          // out of range do not cost any allocation
+          double pathGainLinear = 1;
+          Time delay = MicroSeconds (0);
+          Ptr<MobilityModel> receiverMobility = (*rxPhyIterator)->GetMobility ();
+          if (txMobility && receiverMobility)
+            {
+              double pathLossDb;
+              if (m_pathLossCacheEnabled)
                 {
-                  double pathLossDb = 0;
-                  if (rxParams->txAntenna != 0)
-                    {
-                      Angles txAngles (receiverMobility->GetPosition (), txMobility->GetPosition ());
-                      double txAntennaGain = rxParams->txAntenna->GetGainDb (txAngles);
-                      NS_LOG_LOGIC ("txAntennaGain = " << txAntennaGain << " dB");
-                      pathLossDb -= txAntennaGain;
-                    }
-                  Ptr<AntennaModel> rxAntenna = (*rxPhyIterator)->GetRxAntenna ();
-                  if (rxAntenna != 0)
-                    {
-                      Angles rxAngles (txMobility->GetPosition (), receiverMobility->GetPosition ());
-                      double rxAntennaGain = rxAntenna->GetGainDb (rxAngles);
-                      NS_LOG_LOGIC ("rxAntennaGain = " << rxAntennaGain << " dB");
-                      pathLossDb -= rxAntennaGain;
-                    }
-                  if (m_propagationLoss)
-                    {
-                      double propagationGainDb = m_propagationLoss->CalcRxPower (0, txMobility, receiverMobility);
-                      NS_LOG_LOGIC ("propagationGainDb = " << propagationGainDb << " dB");
-                      pathLossDb -= propagationGainDb;
-                    }                    
-                  NS_LOG_LOGIC ("total pathLoss = " << pathLossDb << " dB");    
-                  m_pathLossTrace (txParams->txPhy, *rxPhyIterator, pathLossDb);
-                  if ( pathLossDb > m_maxLossDb)
-                    {
-                      // beyond range
-                      continue;
-                    }
-                  double pathGainLinear = std::pow (10.0, (-pathLossDb) / 10.0);
-                  *(rxParams->psd) *= pathGainLinear;              
-
-                  if (m_spectrumPropagationLoss)
-                    {
-                      rxParams->psd = m_spectrumPropagationLoss->CalcRxPowerSpectralDensity (rxParams->psd, txMobility, receiverMobility);
-                    }
-
-                  if (m_propagationDelay)
-                    {
-                      delay = m_propagationDelay->GetDelay (txMobility, receiverMobility);
-                    }
+                  const PathLossCacheEntry &entry = GetCachedPathLoss (txParams->txPhy, txMobility, txEpoch,
+                                                                       txParams->txAntenna, *rxPhyIterator,
+                                                                       receiverMobility,
+                                                                       (*rxPhyIterator)->GetRxAntenna ());
+                  pathLossDb = entry.lossDb;
+                  pathGainLinear = entry.gainLinear;
                 }
+              else
+                {
+                  pathLossDb = CalcPathLossDb (txMobility, txParams->txAntenna,
+                                               receiverMobility, (*rxPhyIterator)->GetRxAntenna ());
+                }
+              NS_LOG_LOGIC ("total pathLoss = " << pathLossDb << " dB");
+              m_pathLossTrace (txParams->txPhy, *rxPhyIterator, pathLossDb);
+              if ( pathLossDb > m_maxLossDb)
+                {
+                  // beyond range
+                  continue;
+                }
+              if (!m_pathLossCacheEnabled)
+                {
+                  pathGainLinear = std::pow (10.0, (-pathLossDb) / 10.0);
+                }
+            }
 
-              Ptr<NetDevice> netDev = (*rxPhyIterator)->GetDevice ();
-              if (netDev)
+          // the receivers with the same path gain share the same PSD
+          NS_LOG_LOGIC (" copying signal parameters " << txParams);
+          Ptr<SpectrumSignalParameters> rxParams = txParams->Copy ();
+          rxParams->psd = GetScaledPsd (convertedTxPowerSpectrum, pathGainLinear);
+          if (txMobility && receiverMobility)
+            {
+              if (m_spectrumPropagationLoss)
                 {
-                  // the receiver has a NetDevice, so we expect that it is attached to a Node
-                  uint32_t dstNode =  netDev->GetNode ()->GetId ();
-                  Simulator::ScheduleWithContext (dstNode, delay, &MultiModelSpectrumChannel::StartRx, this,
-                                                  rxParams, *rxPhyIterator);
+                  rxParams->psd = m_spectrumPropagationLoss->CalcRxPowerSpectralDensity (rxParams->psd, txMobility, receiverMobility);
                 }
-              else
+
+              if (m_propagationDelay)
                 {
-                  // the receiver is not attached to a NetDevice, so we cannot assume that it is attached to a node
-                  Simulator::Schedule (delay, &MultiModelSpectrumChannel::StartRx, this,
-                                       rxParams, *rxPhyIterator);
+                  delay = m_propagationDelay->GetDelay (txMobility, receiverMobility);
                 }
             }
+
+          Ptr<NetDevice> netDev = (*rxPhyIterator)->GetDevice ();
+          if (netDev)
+            {
+              // the receiver has a NetDevice, so we expect that it is attached to a Node
+              uint32_t dstNode =  netDev->GetNode ()->GetId ();
+              m_receptions.Add (dstNode, delay, &MultiModelSpectrumChannel::StartRx, this,
+                                rxParams, *rxPhyIterator);
+            }
+          else
+            {
+              // the receiver is not attached to a NetDevice, so we cannot assume that it is attached to a node
+              m_receptions.Add (Simulator::GetContext (), delay, &MultiModelSpectrumChannel::StartRx, this,
+                                rxParams, *rxPhyIterator);
+            }
         }
+      ClearScaledPsds ();
+    }
+  Simulator::ScheduleBatch (m_receptions);
 
+}
+
+const MultiModelSpectrumChannel::PathLossCacheEntry &
+MultiModelSpectrumChannel::GetCachedPathLoss (Ptr<const SpectrumPhy> txPhy, Ptr<MobilityModel> txMobility,
+                                              uint32_t txEpoch, Ptr<AntennaModel> txAntenna,
+                                              Ptr<const SpectrumPhy> rxPhy, Ptr<MobilityModel> rxMobility,
+                                              Ptr<AntennaModel> rxAntenna)
+{
+  PathLossCacheEntry &entry = m_pathLossCache[PathLossCacheKey (PeekPointer (txPhy), PeekPointer (rxPhy))];
+  uint32_t rxEpoch = rxMobility->GetPositionEpoch ();
+  if (entry.txMobility == txMobility && entry.rxMobility == rxMobility
+      && entry.txEpoch == txEpoch && entry.rxEpoch == rxEpoch
+      && entry.txAntenna == txAntenna && entry.rxAntenna == rxAntenna)
+    {
+      NS_LOG_LOGIC ("cached pathLoss = " << entry.lossDb << " dB");
+      return entry;
     }
+  entry.txMobility = txMobility;
+  entry.rxMobility = rxMobility;
+  entry.txAntenna = txAntenna;
+  entry.rxAntenna = rxAntenna;
+  entry.txEpoch = txEpoch;
+  entry.rxEpoch = rxEpoch;
+  entry.lossDb = CalcPathLossDb (txMobility, txAntenna, rxMobility, rxAntenna);
+  entry.gainLinear = std::pow (10.0, (-entry.lossDb) / 10.0);
+  return entry;
+}
 
+void
+MultiModelSpectrumChannel::InvalidatePathLossCache (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_pathLossCache.clear ();
 }
 
 void
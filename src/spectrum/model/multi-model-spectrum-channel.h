@@ -27,8 +27,12 @@
 #include <ns3/spectrum-channel.h>
 #include <ns3/spectrum-propagation-loss-model.h>
 #include <ns3/propagation-delay-model.h>
+#include <ns3/event-batch.h>
+#include <ns3/antenna-model.h>
 #include <map>
 #include <set>
+#include <unordered_map>
+#include <utility>
 
 namespace ns3 {
 
@@ -102,6 +106,17 @@ typedef std::map<SpectrumModelUid_t, RxSpectrumModelInfo> RxSpectrumModelInfoMap
  * for this to work is that, after the SpectrumPhy switched its
  * SpectrumModel,  MultiModelSpectrumChannel::AddRx () is
  * called again passing the pointer to that SpectrumPhy.
+ *
+ * \note When the EnablePathLossCache attribute is true, the path loss
+ * (antenna gains and PropagationLossModel) of each pair of transmitting
+ * and receiving SpectrumPhy is cached, and only computed again when the
+ * position epoch (see MobilityModel::GetPositionEpoch) of one of the
+ * two mobility models, or one of the two antenna models, changed. This
+ * is only correct when the PropagationLossModel is a deterministic
+ * function of the positions, and when the gains of the antenna models
+ * do not change over time; otherwise, the cache must be disabled, or
+ * invalidated with InvalidatePathLossCache () at each change. The
+ * SpectrumPropagationLossModel (e.g. fast fading) is never cached.
  */
 class MultiModelSpectrumChannel : public SpectrumChannel
 {
@@ -124,6 +139,11 @@ public:
   virtual std::size_t GetNDevices (void) const;
   virtual Ptr<NetDevice> GetDevice (std::size_t i) const;
 
+  /**
+   * Remove all the entries of the path loss cache, e.g. after a change
+   * of the attributes of the PropagationLossModel or of an antenna model.
+   */
+  void InvalidatePathLossCache (void);
 
 protected:
   void DoDispose ();
@@ -149,6 +169,57 @@ private:
    */
   virtual void StartRx (Ptr<SpectrumSignalParameters> params, Ptr<SpectrumPhy> receiver);
 
+  /**
+   * Path loss of a pair of transmitting and receiving SpectrumPhy,
+   * with the state it was computed for.
+   */
+  struct PathLossCacheEntry
+  {
+    Ptr<const MobilityModel> txMobility; //!< The mobility model of the transmitter.
+    Ptr<const MobilityModel> rxMobility; //!< The mobility model of the receiver.
+    Ptr<const AntennaModel> txAntenna;   //!< The antenna model of the transmitter.
+    Ptr<const AntennaModel> rxAntenna;   //!< The antenna model of the receiver.
+    uint32_t txEpoch;                    //!< The position epoch of the transmitter.
+    uint32_t rxEpoch;                    //!< The position epoch of the receiver.
+    double lossDb;                       //!< The path loss (dB).
+    double gainLinear;                   //!< The path gain (linear units).
+  };
+
+  /// Key of the path loss cache: the transmitting and receiving SpectrumPhy.
+  typedef std::pair<const SpectrumPhy *, const SpectrumPhy *> PathLossCacheKey;
+
+  /// Hash function of the keys of the path loss cache.
+  struct PathLossCacheKeyHash
+  {
+    /**
+     * \param key the key
+     * \return the hash of the key
+     */
+    std::size_t operator () (const PathLossCacheKey &key) const
+    {
+      std::size_t h = std::hash<const SpectrumPhy *> () (key.first);
+      return h ^ (std::hash<const SpectrumPhy *> () (key.second) + 0x9e3779b9 + (h << 6) + (h >> 2));
+    }
+  };
+
+  /**
+   * Get the path loss between a transmitter and a receiver from the
+   * path loss cache, computing it if the cache entry is missing or stale.
+   *
+   * \param txPhy the transmitting SpectrumPhy
+   * \param txMobility the mobility model of the transmitter
+   * \param txEpoch the position epoch of the transmitter
+   * \param txAntenna the antenna model of the transmitter, or 0
+   * \param rxPhy the receiving SpectrumPhy
+   * \param rxMobility the mobility model of the receiver
+   * \param rxAntenna the antenna model of the receiver, or 0
+   * \return the up-to-date cache entry
+   */
+  const PathLossCacheEntry & GetCachedPathLoss (Ptr<const SpectrumPhy> txPhy, Ptr<MobilityModel> txMobility,
+                                                uint32_t txEpoch, Ptr<AntennaModel> txAntenna,
+                                                Ptr<const SpectrumPhy> rxPhy, Ptr<MobilityModel> rxMobility,
+                                                Ptr<AntennaModel> rxAntenna);
+
   /**
    * Data structure holding, for each TX SpectrumModel,  all the
    * converters to any RX SpectrumModel, and all the corresponding
@@ -169,6 +240,26 @@ private:
    */
   std::size_t m_numDevices;
 
+  /**
+   * Receptions scheduled by StartTx, kept to reuse its storage.
+   */
+  EventBatch m_receptions;
+
+  /**
+   * True if the path losses are cached.
+   */
+  bool m_pathLossCacheEnabled;
+
+  /**
+   * Cached path loss of each pair of transmitting and receiving SpectrumPhy.
+   */
+  std::unordered_map<PathLossCacheKey, PathLossCacheEntry, PathLossCacheKeyHash> m_pathLossCache;
+
+  /**
+   * The PropagationLossModel the cached path losses were computed with.
+   */
+  const PropagationLossModel *m_pathLossCacheModel;
+
 };
 
 
@@ -110,75 +110,63 @@ SingleModelSpectrumChannel::StartTx (Ptr<SpectrumSignalParameters> txParams)
        rxPhyIterator != m_phyList.end ();
        ++rxPhyIterator)
     {
-      if ((*rxPhyIterator) != txParams->txPhy)
+      if ((*rxPhyIterator) == txParams->txPhy)
         {
-          Time delay  = MicroSeconds (0);
-
-          Ptr<MobilityModel> receiverMobility = (*rxPhyIterator)->GetMobility ();
-          NS_LOG_LOGIC ("copying signal parameters " << txParams);
-          Ptr<SpectrumSignalParameters> rxParams = txParams->Copy ();
+          continue;
+        }
 
-          if (senderMobility && receiverMobility)
+      // compute the scalar path loss first, so that the receivers out of
+      // range do not cost any allocation
+      double pathGainLinear = 1;
+      Time delay  = MicroSeconds (0);
+      Ptr<MobilityModel> receiverMobility = (*rxPhyIterator)->GetMobility ();
+      if (senderMobility && receiverMobility)
+        {
+          double pathLossDb = CalcPathLossDb (senderMobility, txParams->txAntenna,
+                                              receiverMobility, (*rxPhyIterator)->GetRxAntenna ());
+          NS_LOG_LOGIC ("total pathLoss = " << pathLossDb << " dB");
+          m_pathLossTrace (txParams->txPhy, *rxPhyIterator, pathLossDb);
+          if ( pathLossDb > m_maxLossDb)
             {
-              double pathLossDb = 0;
-              if (rxParams->txAntenna != 0)
-                {
-                  Angles txAngles (receiverMobility->GetPosition (), senderMobility->GetPosition ());
-                  double txAntennaGain = rxParams->txAntenna->GetGainDb (txAngles);
-                  NS_LOG_LOGIC ("txAntennaGain = " << txAntennaGain << " dB");
-                  pathLossDb -= txAntennaGain;
-                }
-              Ptr<AntennaModel> rxAntenna = (*rxPhyIterator)->GetRxAntenna ();
-              if (rxAntenna != 0)
-                {
-                  Angles rxAngles (senderMobility->GetPosition (), receiverMobility->GetPosition ());
-                  double rxAntennaGain = rxAntenna->GetGainDb (rxAngles);
-                  NS_LOG_LOGIC ("rxAntennaGain = " << rxAntennaGain << " dB");
-                  pathLossDb -= rxAntennaGain;
-                }
-              if (m_propagationLoss)
-                {
-                  double propagationGainDb = m_propagationLoss->CalcRxPower (0, senderMobility, receiverMobility);
-                  NS_LOG_LOGIC ("propagationGainDb = " << propagationGainDb << " dB");
-                  pathLossDb -= propagationGainDb;
-                }                    
-              NS_LOG_LOGIC ("total pathLoss = " << pathLossDb << " dB");    
-              m_pathLossTrace (txParams->txPhy, *rxPhyIterator, pathLossDb);
-              if ( pathLossDb > m_maxLossDb)
-                {
-                  // beyond range
-                  continue;
-                }
-              double pathGainLinear = std::pow (10.0, (-pathLossDb) / 10.0);
-              *(rxParams->psd) *= pathGainLinear;              
-
-              if (m_spectrumPropagationLoss)
-                {
-                  rxParams->psd = m_spectrumPropagationLoss->CalcRxPowerSpectralDensity (rxParams->psd, senderMobility, receiverMobility);
-                }
-
-              if (m_propagationDelay)
-                {
-                  delay = m_propagationDelay->GetDelay (senderMobility, receiverMobility);
-                }
+              // beyond range
+              continue;
             }
+          pathGainLinear = std::pow (10.0, (-pathLossDb) / 10.0);
+        }
 
-
-          Ptr<NetDevice> netDev = (*rxPhyIterator)->GetDevice ();
-          if (netDev)
+      // the receivers with the same path gain share the same PSD
+      NS_LOG_LOGIC ("copying signal parameters " << txParams);
+      Ptr<SpectrumSignalParameters> rxParams = txParams->Copy ();
+      rxParams->psd = GetScaledPsd (txParams->psd, pathGainLinear);
+      if (senderMobility && receiverMobility)
+        {
+          if (m_spectrumPropagationLoss)
             {
-              // the receiver has a NetDevice, so we expect that it is attached to a Node
-              uint32_t dstNode =  netDev->GetNode ()->GetId ();
-              Simulator::ScheduleWithContext (dstNode, delay, &SingleModelSpectrumChannel::StartRx, this, rxParams, *rxPhyIterator);
+              rxParams->psd = m_spectrumPropagationLoss->CalcRxPowerSpectralDensity (rxParams->psd, senderMobility, receiverMobility);
             }
-          else
+
+          if (m_propagationDelay)
             {
-              // the receiver is not attached to a NetDevice, so we cannot assume that it is attached to a node
-              Simulator::Schedule (delay, &SingleModelSpectrumChannel::StartRx, this,
-                                   rxParams, *rxPhyIterator);
+              delay = m_propagationDelay->GetDelay (senderMobility, receiverMobility);
             }
         }
+
+      Ptr<NetDevice> netDev = (*rxPhyIterator)->GetDevice ();
+      if (netDev)
+        {
+          // the receiver has a NetDevice, so we expect that it is attached to a Node
+          uint32_t dstNode =  netDev->GetNode ()->GetId ();
+          m_receptions.Add (dstNode, delay, &SingleModelSpectrumChannel::StartRx, this, rxParams, *rxPhyIterator);
+        }
+      else
+        {
+          // the receiver is not attached to a NetDevice, so we cannot assume that it is attached to a node
+          m_receptions.Add (Simulator::GetContext (), delay, &SingleModelSpectrumChannel::StartRx, this,
+                            rxParams, *rxPhyIterator);
+        }
     }
+  ClearScaledPsds ();
+  Simulator::ScheduleBatch (m_receptions);
 }
 
 void
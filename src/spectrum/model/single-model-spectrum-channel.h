@@ -25,6 +25,7 @@
 #include <ns3/spectrum-channel.h>
 #include <ns3/spectrum-model.h>
 #include <ns3/traced-callback.h>
+#include <ns3/event-batch.h>
 
 namespace ns3 {
 
@@ -82,6 +83,11 @@ private:
    */
   Ptr<const SpectrumModel> m_spectrumModel;
 
+  /**
+   * Receptions scheduled by StartTx, kept to reuse its storage.
+   */
+  EventBatch m_receptions;
+
 };
 
 }
@@ -21,6 +21,9 @@
 #include <ns3/log.h>
 #include <ns3/double.h>
 #include <ns3/pointer.h>
+#include <ns3/antenna-model.h>
+#include <ns3/angles.h>
+#include <ns3/spectrum-value.h>
 
 #include "spectrum-channel.h"
 
@@ -149,5 +152,60 @@ SpectrumChannel::GetSpectrumPropagationLossModel (void)
   return m_spectrumPropagationLoss;
 }
 
+double
+SpectrumChannel::CalcPathLossDb (Ptr<MobilityModel> txMobility, Ptr<AntennaModel> txAntenna,
+                                 Ptr<MobilityModel> rxMobility, Ptr<AntennaModel> rxAntenna) const
+{
+  double pathLossDb = 0;
+  if (txAntenna != 0)
+    {
+      Angles txAngles (rxMobility->GetPosition (), txMobility->GetPosition ());
+      double txAntennaGain = txAntenna->GetGainDb (txAngles);
+      NS_LOG_LOGIC ("txAntennaGain = " << txAntennaGain << " dB");
+      pathLossDb -= txAntennaGain;
+    }
+  if (rxAntenna != 0)
+    {
+      Angles rxAngles (txMobility->GetPosition (), rxMobility->GetPosition ());
+      double rxAntennaGain = rxAntenna->GetGainDb (rxAngles);
+      NS_LOG_LOGIC ("rxAntennaGain = " << rxAntennaGain << " dB");
+      pathLossDb -= rxAntennaGain;
+    }
+  if (m_propagationLoss)
+    {
+      double propagationGainDb = m_propagationLoss->CalcRxPower (0, txMobility, rxMobility);
+      NS_LOG_LOGIC ("propagationGainDb = " << propagationGainDb << " dB");
+      pathLossDb -= propagationGainDb;
+    }
+  return pathLossDb;
+}
+
+Ptr<SpectrumValue>
+SpectrumChannel::GetScaledPsd (Ptr<const SpectrumValue> psd, double gainLinear)
+{
+  Ptr<SpectrumValue> &scaled = m_scaledPsds[gainLinear];
+  if (scaled == 0)
+    {
+      // scale while copying, in a single pass over the bands
+      scaled = Create<SpectrumValue> (psd->GetSpectrumModel ());
+      Values::const_iterator in = psd->ConstValuesBegin ();
+      for (Values::iterator out = scaled->ValuesBegin (); out != scaled->ValuesEnd (); ++out, ++in)
+        {
+          *out = *in * gainLinear;
+        }
+    }
+  else
+    {
+      NS_LOG_LOGIC ("sharing the PSD of gain " << gainLinear);
+    }
+  return scaled;
+}
+
+void
+SpectrumChannel::ClearScaledPsds (void)
+{
+  m_scaledPsds.clear ();
+}
+
 
 } // namespace
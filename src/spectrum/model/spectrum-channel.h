@@ -32,12 +32,14 @@
 #include <ns3/spectrum-phy.h>
 #include <ns3/traced-callback.h>
 #include <ns3/mobility-model.h>
+#include <unordered_map>
 
 namespace ns3 {
 
 
 class PacketBurst;
 class SpectrumValue;
+class AntennaModel;
 
 /**
  * \ingroup spectrum
@@ -154,6 +156,37 @@ public:
 
 protected:
 
+  /**
+   * Compute the path loss between a transmitter and a receiver,
+   * including the antenna gains.
+   *
+   * \param txMobility the mobility model of the transmitter
+   * \param txAntenna the antenna model of the transmitter, or 0
+   * \param rxMobility the mobility model of the receiver
+   * \param rxAntenna the antenna model of the receiver, or 0
+   * \return the path loss in dB
+   */
+  double CalcPathLossDb (Ptr<MobilityModel> txMobility, Ptr<AntennaModel> txAntenna,
+                         Ptr<MobilityModel> rxMobility, Ptr<AntennaModel> rxAntenna) const;
+
+  /**
+   * Get the PSD of a transmission scaled by a gain. The receivers of a
+   * transmission with the same gain, e.g. co-located receivers, share the
+   * same PSD, which the receivers must thus not modify. The PSDs are
+   * shared until ClearScaledPsds () is called.
+   *
+   * \param psd the PSD of the transmission
+   * \param gainLinear the gain (linear units)
+   * \return the scaled PSD
+   */
+  Ptr<SpectrumValue> GetScaledPsd (Ptr<const SpectrumValue> psd, double gainLinear);
+
+  /**
+   * Stop sharing the PSDs returned by GetScaledPsd (), at the end of a
+   * transmission or before scaling a different PSD.
+   */
+  void ClearScaledPsds (void);
+
   /**
    * The `PathLoss` trace source. Exporting the pointers to the Tx and Rx
    * SpectrumPhy and a pathloss value, in dB.
@@ -194,6 +227,11 @@ protected:
    */
   Ptr<SpectrumPropagationLossModel> m_spectrumPropagationLoss;
 
+private:
+  /**
+   * The PSDs returned by GetScaledPsd (), indexed by gain.
+   */
+  std::unordered_map<double, Ptr<SpectrumValue> > m_scaledPsds;
 
 };
 
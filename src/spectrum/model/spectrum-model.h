@@ -128,8 +128,19 @@ public:
    */
   bool IsOrthogonal (const SpectrumModel &other) const;
 
+  /**
+   * \return the widths (fh - fl) of the bands, in the order of the bands
+   */
+  const std::vector<double>& GetBandWidths () const;
+
 private:
+  /**
+   * Compute m_bandWidths from m_bands.
+   */
+  void ComputeBandWidths ();
+
   Bands m_bands;         //!< Actual definition of frequency bands within this SpectrumModel
+  std::vector<double> m_bandWidths; //!< The widths of the bands
   SpectrumModelUid_t m_uid;        //!< unique id for a given set of frequencies
   static SpectrumModelUid_t m_uidCount;    //!< counter to assign m_uids
 };
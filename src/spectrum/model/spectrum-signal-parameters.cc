@@ -43,7 +43,7 @@ SpectrumSignalParameters::~SpectrumSignalParameters ()
 SpectrumSignalParameters::SpectrumSignalParameters (const SpectrumSignalParameters& p)
 {
   NS_LOG_FUNCTION (this << &p);
-  psd = p.psd->Copy ();
+  psd = p.psd;
   duration = p.duration;
   txPhy = p.txPhy;
   txAntenna = p.txAntenna;
@@ -22,11 +22,505 @@
 #include <ns3/spectrum-value.h>
 #include <ns3/math.h>
 #include <ns3/log.h>
+#include <ns3/abort.h>
+#include <algorithm>
+#include <cstdlib>
+#include <stdint.h>
+#include <new>
+
+#if (defined (__x86_64__) || defined (__i386__)) && defined (__GNUC__)
+#include <immintrin.h>
+/// The SSE2 and AVX2 kernels are built with the function attributes of GCC and Clang.
+#define SPECTRUM_VALUE_X86_KERNELS
+/// Compile a function for SSE2.
+#define SPECTRUM_VALUE_SSE2 __attribute__ ((target ("sse2")))
+/// Compile a function for AVX2.
+#define SPECTRUM_VALUE_AVX2 __attribute__ ((target ("avx2")))
+#endif
 
 namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("SpectrumValue");
 
+/*
+ * The kernels of the arithmetic of SpectrumValue. Each instruction set
+ * has a set of kernels; the kernels of the elementwise operations
+ * compute r[i] = a[i] op b[i] (or a[i] op s), with r possibly equal to a.
+ * The sums are accumulated in four interleaved partial sums, lane k
+ * accumulating the elements k, k + 4, k + 8..., which are then added as
+ * (s0 + s2) + (s1 + s3), followed by the remaining elements in order;
+ * the same order in all the instruction sets gives the same results.
+ */
+
+/// The kernels of an instruction set.
+struct SpectrumValueKernels
+{
+  /// Elementwise operation of two arrays.
+  typedef void (*BinaryKernel)(double *r, const double *a, const double *b, size_t n);
+  /// Elementwise operation of an array and a scalar.
+  typedef void (*ScalarKernel)(double *r, const double *a, double s, size_t n);
+  /// Sum of an array.
+  typedef double (*SumKernel)(const double *a, size_t n);
+
+  BinaryKernel add; //!< r = a + b
+  BinaryKernel sub; //!< r = a - b
+  BinaryKernel mul; //!< r = a * b
+  BinaryKernel div; //!< r = a / b
+  ScalarKernel addScalar; //!< r = a + s
+  ScalarKernel mulScalar; //!< r = a * s
+  ScalarKernel divScalar; //!< r = a / s
+  SumKernel sum;    //!< sum of a
+};
+
+/// Addition.
+struct SpectrumValueAddOp
+{
+  static double Apply (double a, double b)
+  {
+    return a + b;
+  }
+#ifdef SPECTRUM_VALUE_X86_KERNELS
+  SPECTRUM_VALUE_SSE2 static __m128d Apply (__m128d a, __m128d b)
+  {
+    return _mm_add_pd (a, b);
+  }
+  SPECTRUM_VALUE_AVX2 static __m256d Apply (__m256d a, __m256d b)
+  {
+    return _mm256_add_pd (a, b);
+  }
+#endif
+};
+
+/// Subtraction.
+struct SpectrumValueSubOp
+{
+  static double Apply (double a, double b)
+  {
+    return a - b;
+  }
+#ifdef SPECTRUM_VALUE_X86_KERNELS
+  SPECTRUM_VALUE_SSE2 static __m128d Apply (__m128d a, __m128d b)
+  {
+    return _mm_sub_pd (a, b);
+  }
+  SPECTRUM_VALUE_AVX2 static __m256d Apply (__m256d a, __m256d b)
+  {
+    return _mm256_sub_pd (a, b);
+  }
+#endif
+};
+
+/// Multiplication.
+struct SpectrumValueMulOp
+{
+  static double Apply (double a, double b)
+  {
+    return a * b;
+  }
+#ifdef SPECTRUM_VALUE_X86_KERNELS
+  SPECTRUM_VALUE_SSE2 static __m128d Apply (__m128d a, __m128d b)
+  {
+    return _mm_mul_pd (a, b);
+  }
+  SPECTRUM_VALUE_AVX2 static __m256d Apply (__m256d a, __m256d b)
+  {
+    return _mm256_mul_pd (a, b);
+  }
+#endif
+};
+
+/// Division.
+struct SpectrumValueDivOp
+{
+  static double Apply (double a, double b)
+  {
+    return a / b;
+  }
+#ifdef SPECTRUM_VALUE_X86_KERNELS
+  SPECTRUM_VALUE_SSE2 static __m128d Apply (__m128d a, __m128d b)
+  {
+    return _mm_div_pd (a, b);
+  }
+  SPECTRUM_VALUE_AVX2 static __m256d Apply (__m256d a, __m256d b)
+  {
+    return _mm256_div_pd (a, b);
+  }
+#endif
+};
+
+/// Elementwise operation of two arrays, in portable C++.
+template <class Op>
+static void
+BinaryScalar (double *r, const double *a, const double *b, size_t n)
+{
+  for (size_t i = 0; i < n; ++i)
+    {
+      r[i] = Op::Apply (a[i], b[i]);
+    }
+}
+
+/// Elementwise operation of an array and a scalar, in portable C++.
+template <class Op>
+static void
+ScalarScalar (double *r, const double *a, double s, size_t n)
+{
+  for (size_t i = 0; i < n; ++i)
+    {
+      r[i] = Op::Apply (a[i], s);
+    }
+}
+
+/// Sum of an array, in portable C++.
+static double
+SumScalar (const double *a, size_t n)
+{
+  double s0 = 0;
+  double s1 = 0;
+  double s2 = 0;
+  double s3 = 0;
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+    {
+      s0 += a[i];
+      s1 += a[i + 1];
+      s2 += a[i + 2];
+      s3 += a[i + 3];
+    }
+  double s = (s0 + s2) + (s1 + s3);
+  for (; i < n; ++i)
+    {
+      s += a[i];
+    }
+  return s;
+}
+
+/// The kernels of the SCALAR instruction set.
+static const SpectrumValueKernels g_scalarKernels = {
+  &BinaryScalar<SpectrumValueAddOp>,
+  &BinaryScalar<SpectrumValueSubOp>,
+  &BinaryScalar<SpectrumValueMulOp>,
+  &BinaryScalar<SpectrumValueDivOp>,
+  &ScalarScalar<SpectrumValueAddOp>,
+  &ScalarScalar<SpectrumValueMulOp>,
+  &ScalarScalar<SpectrumValueDivOp>,
+  &SumScalar
+};
+
+#ifdef SPECTRUM_VALUE_X86_KERNELS
+
+/// Elementwise operation of two arrays, with SSE2.
+template <class Op>
+SPECTRUM_VALUE_SSE2 static void
+BinarySse2 (double *r, const double *a, const double *b, size_t n)
+{
+  size_t i = 0;
+  for (; i + 2 <= n; i += 2)
+    {
+      _mm_storeu_pd (r + i, Op::Apply (_mm_loadu_pd (a + i), _mm_loadu_pd (b + i)));
+    }
+  for (; i < n; ++i)
+    {
+      r[i] = Op::Apply (a[i], b[i]);
+    }
+}
+
+/// Elementwise operation of an array and a scalar, with SSE2.
+template <class Op>
+SPECTRUM_VALUE_SSE2 static void
+ScalarSse2 (double *r, const double *a, double s, size_t n)
+{
+  __m128d vs = _mm_set1_pd (s);
+  size_t i = 0;
+  for (; i + 2 <= n; i += 2)
+    {
+      _mm_storeu_pd (r + i, Op::Apply (_mm_loadu_pd (a + i), vs));
+    }
+  for (; i < n; ++i)
+    {
+      r[i] = Op::Apply (a[i], s);
+    }
+}
+
+/// Sum of an array, with SSE2.
+SPECTRUM_VALUE_SSE2 static double
+SumSse2 (const double *a, size_t n)
+{
+  // lanes 0 and 1, lanes 2 and 3
+  __m128d s01 = _mm_setzero_pd ();
+  __m128d s23 = _mm_setzero_pd ();
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+    {
+      s01 = _mm_add_pd (s01, _mm_loadu_pd (a + i));
+      s23 = _mm_add_pd (s23, _mm_loadu_pd (a + i + 2));
+    }
+  __m128d t = _mm_add_pd (s01, s23);
+  double s = _mm_cvtsd_f64 (t) + _mm_cvtsd_f64 (_mm_unpackhi_pd (t, t));
+  for (; i < n; ++i)
+    {
+      s += a[i];
+    }
+  return s;
+}
+
+/// The kernels of the SSE2 instruction set.
+static const SpectrumValueKernels g_sse2Kernels = {
+  &BinarySse2<SpectrumValueAddOp>,
+  &BinarySse2<SpectrumValueSubOp>,
+  &BinarySse2<SpectrumValueMulOp>,
+  &BinarySse2<SpectrumValueDivOp>,
+  &ScalarSse2<SpectrumValueAddOp>,
+  &ScalarSse2<SpectrumValueMulOp>,
+  &ScalarSse2<SpectrumValueDivOp>,
+  &SumSse2
+};
+
+/// Elementwise operation of two arrays, with AVX2.
+template <class Op>
+SPECTRUM_VALUE_AVX2 static void
+BinaryAvx2 (double *r, const double *a, const double *b, size_t n)
+{
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+    {
+      _mm256_storeu_pd (r + i, Op::Apply (_mm256_loadu_pd (a + i), _mm256_loadu_pd (b + i)));
+    }
+  for (; i < n; ++i)
+    {
+      r[i] = Op::Apply (a[i], b[i]);
+    }
+}
+
+/// Elementwise operation of an array and a scalar, with AVX2.
+template <class Op>
+SPECTRUM_VALUE_AVX2 static void
+ScalarAvx2 (double *r, const double *a, double s, size_t n)
+{
+  __m256d vs = _mm256_set1_pd (s);
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+    {
+      _mm256_storeu_pd (r + i, Op::Apply (_mm256_loadu_pd (a + i), vs));
+    }
+  for (; i < n; ++i)
+    {
+      r[i] = Op::Apply (a[i], s);
+    }
+}
+
+/// Sum of an array, with AVX2.
+SPECTRUM_VALUE_AVX2 static double
+SumAvx2 (const double *a, size_t n)
+{
+  __m256d s0123 = _mm256_setzero_pd ();
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+    {
+      s0123 = _mm256_add_pd (s0123, _mm256_loadu_pd (a + i));
+    }
+  __m128d t = _mm_add_pd (_mm256_castpd256_pd128 (s0123), _mm256_extractf128_pd (s0123, 1));
+  double s = _mm_cvtsd_f64 (t) + _mm_cvtsd_f64 (_mm_unpackhi_pd (t, t));
+  for (; i < n; ++i)
+    {
+      s += a[i];
+    }
+  return s;
+}
+
+/// The kernels of the AVX2 instruction set.
+static const SpectrumValueKernels g_avx2Kernels = {
+  &BinaryAvx2<SpectrumValueAddOp>,
+  &BinaryAvx2<SpectrumValueSubOp>,
+  &BinaryAvx2<SpectrumValueMulOp>,
+  &BinaryAvx2<SpectrumValueDivOp>,
+  &ScalarAvx2<SpectrumValueAddOp>,
+  &ScalarAvx2<SpectrumValueMulOp>,
+  &ScalarAvx2<SpectrumValueDivOp>,
+  &SumAvx2
+};
+
+#endif /* SPECTRUM_VALUE_X86_KERNELS */
+
+/**
+ * \return the instruction set used by the arithmetic, initially the
+ * best one supported
+ */
+static SpectrumValue::InstructionSet &
+CurrentInstructionSet (void)
+{
+  static SpectrumValue::InstructionSet instructionSet =
+    SpectrumValue::IsInstructionSetSupported (SpectrumValue::AVX2) ? SpectrumValue::AVX2
+    : SpectrumValue::IsInstructionSetSupported (SpectrumValue::SSE2) ? SpectrumValue::SSE2
+    : SpectrumValue::SCALAR;
+  return instructionSet;
+}
+
+/**
+ * \return the kernels of the instruction set used by the arithmetic
+ */
+static const SpectrumValueKernels &
+Kernels (void)
+{
+#ifdef SPECTRUM_VALUE_X86_KERNELS
+  switch (CurrentInstructionSet ())
+    {
+    case SpectrumValue::AVX2:
+      return g_avx2Kernels;
+    case SpectrumValue::SSE2:
+      return g_sse2Kernels;
+    default:
+      break;
+    }
+#endif
+  return g_scalarKernels;
+}
+
+bool
+SpectrumValue::IsInstructionSetSupported (InstructionSet instructionSet)
+{
+  switch (instructionSet)
+    {
+    case SCALAR:
+      return true;
+#ifdef SPECTRUM_VALUE_X86_KERNELS
+    case SSE2:
+      // the CPU features may be needed before the static constructors
+      __builtin_cpu_init ();
+      return __builtin_cpu_supports ("sse2");
+    case AVX2:
+      __builtin_cpu_init ();
+      return __builtin_cpu_supports ("avx2");
+#endif
+    default:
+      return false;
+    }
+}
+
+void
+SpectrumValue::SetInstructionSet (InstructionSet instructionSet)
+{
+  NS_LOG_FUNCTION (instructionSet);
+  NS_ABORT_MSG_UNLESS (IsInstructionSetSupported (instructionSet),
+                       "instruction set " << instructionSet << " not supported");
+  CurrentInstructionSet () = instructionSet;
+}
+
+SpectrumValue::InstructionSet
+SpectrumValue::GetInstructionSet (void)
+{
+  return CurrentInstructionSet ();
+}
+
+
+const size_t Values::INLINE_CAPACITY;
+const size_t Values::ALIGNMENT;
+
+Values::Values ()
+  : m_data (m_inline),
+    m_size (0)
+{
+}
+
+Values::Values (size_t n)
+  : m_data (m_inline),
+    m_size (0)
+{
+  Resize (n);
+  std::fill (m_data, m_data + n, 0.0);
+}
+
+Values::Values (const Values& o)
+  : m_data (m_inline),
+    m_size (0)
+{
+  Resize (o.m_size);
+  std::copy (o.m_data, o.m_data + o.m_size, m_data);
+}
+
+Values::Values (Values&& o)
+  : m_data (m_inline),
+    m_size (0)
+{
+  *this = std::move (o);
+}
+
+Values::~Values ()
+{
+  Release ();
+}
+
+Values&
+Values::operator= (const Values& o)
+{
+  if (this != &o)
+    {
+      Resize (o.m_size);
+      std::copy (o.m_data, o.m_data + o.m_size, m_data);
+    }
+  return *this;
+}
+
+Values&
+Values::operator= (Values&& o)
+{
+  if (this == &o)
+    {
+      return *this;
+    }
+  if (o.m_data == o.m_inline)
+    {
+      Resize (o.m_size);
+      std::copy (o.m_data, o.m_data + o.m_size, m_data);
+    }
+  else
+    {
+      // take over the heap allocation
+      Release ();
+      m_data = o.m_data;
+      m_size = o.m_size;
+      o.m_data = o.m_inline;
+      o.m_size = 0;
+    }
+  return *this;
+}
+
+void
+Values::Resize (size_t n)
+{
+  if (n == m_size)
+    {
+      return;
+    }
+  Release ();
+  if (n > INLINE_CAPACITY)
+    {
+      // malloc is much faster than posix_memalign: align by hand, and
+      // keep the address of the allocation just before the values
+      void *allocation = std::malloc (n * sizeof (double) + ALIGNMENT + sizeof (void *));
+      if (allocation == 0)
+        {
+          throw std::bad_alloc ();
+        }
+      uintptr_t address = reinterpret_cast<uintptr_t> (allocation) + sizeof (void *);
+      address = (address + ALIGNMENT - 1) & ~static_cast<uintptr_t> (ALIGNMENT - 1);
+      m_data = reinterpret_cast<double *> (address);
+      reinterpret_cast<void **> (m_data)[-1] = allocation;
+    }
+  m_size = n;
+}
+
+void
+Values::Release (void)
+{
+  if (m_data != m_inline)
+    {
+      std::free (reinterpret_cast<void **> (m_data)[-1]);
+      m_data = m_inline;
+    }
+  m_size = 0;
+}
+
+
 SpectrumValue::SpectrumValue ()
 {
 }
@@ -106,31 +600,16 @@ SpectrumValue::ConstBandsEnd () const
 void
 SpectrumValue::Add (const SpectrumValue& x)
 {
-  Values::iterator it1 = m_values.begin ();
-  Values::const_iterator it2 = x.m_values.begin ();
-
   NS_ASSERT (m_spectrumModel == x.m_spectrumModel);
-
-  while (it1 != m_values.end ())
-    {
-      NS_ASSERT ( it2 != x.m_values.end ());
-      *it1 += *it2;
-      ++it1;
-      ++it2;
-    }
+  NS_ASSERT (m_values.size () <= x.m_values.size ());
+  Kernels ().add (m_values.data (), m_values.data (), x.m_values.data (), m_values.size ());
 }
 
 
 void
 SpectrumValue::Add (double s)
 {
-  Values::iterator it1 = m_values.begin ();
-
-  while (it1 != m_values.end ())
-    {
-      *it1 += s;
-      ++it1;
-    }
+  Kernels ().addScalar (m_values.data (), m_values.data (), s, m_values.size ());
 }
 
 
@@ -138,18 +617,9 @@ SpectrumValue::Add (double s)
 void
 SpectrumValue::Subtract (const SpectrumValue& x)
 {
-  Values::iterator it1 = m_values.begin ();
-  Values::const_iterator it2 = x.m_values.begin ();
-
   NS_ASSERT (m_spectrumModel == x.m_spectrumModel);
-
-  while (it1 != m_values.end ())
-    {
-      NS_ASSERT ( it2 != x.m_values.end ());
-      *it1 -= *it2;
-      ++it1;
-      ++it2;
-    }
+  NS_ASSERT (m_values.size () <= x.m_values.size ());
+  Kernels ().sub (m_values.data (), m_values.data (), x.m_values.data (), m_values.size ());
 }
 
 
@@ -164,31 +634,16 @@ SpectrumValue::Subtract (double s)
 void
 SpectrumValue::Multiply (const SpectrumValue& x)
 {
-  Values::iterator it1 = m_values.begin ();
-  Values::const_iterator it2 = x.m_values.begin ();
-
   NS_ASSERT (m_spectrumModel == x.m_spectrumModel);
-
-  while (it1 != m_values.end ())
-    {
-      NS_ASSERT ( it2 != x.m_values.end ());
-      *it1 *= *it2;
-      ++it1;
-      ++it2;
-    }
+  NS_ASSERT (m_values.size () <= x.m_values.size ());
+  Kernels ().mul (m_values.data (), m_values.data (), x.m_values.data (), m_values.size ());
 }
 
 
 void
 SpectrumValue::Multiply (double s)
 {
-  Values::iterator it1 = m_values.begin ();
-
-  while (it1 != m_values.end ())
-    {
-      *it1 *= s;
-      ++it1;
-    }
+  Kernels ().mulScalar (m_values.data (), m_values.data (), s, m_values.size ());
 }
 
 
@@ -197,18 +652,9 @@ SpectrumValue::Multiply (double s)
 void
 SpectrumValue::Divide (const SpectrumValue& x)
 {
-  Values::iterator it1 = m_values.begin ();
-  Values::const_iterator it2 = x.m_values.begin ();
-
   NS_ASSERT (m_spectrumModel == x.m_spectrumModel);
-
-  while (it1 != m_values.end ())
-    {
-      NS_ASSERT ( it2 != x.m_values.end ());
-      *it1 /= *it2;
-      ++it1;
-      ++it2;
-    }
+  NS_ASSERT (m_values.size () <= x.m_values.size ());
+  Kernels ().div (m_values.data (), m_values.data (), x.m_values.data (), m_values.size ());
 }
 
 
@@ -216,13 +662,7 @@ void
 SpectrumValue::Divide (double s)
 {
   NS_LOG_FUNCTION (this << s);
-  Values::iterator it1 = m_values.begin ();
-
-  while (it1 != m_values.end ())
-    {
-      *it1 /= s;
-      ++it1;
-    }
+  Kernels ().divScalar (m_values.data (), m_values.data (), s, m_values.size ());
 }
 
 
@@ -347,28 +787,18 @@ SpectrumValue::Log ()
 double
 Norm (const SpectrumValue& x)
 {
-  double s = 0;
-  Values::const_iterator it1 = x.ConstValuesBegin ();
-  while (it1 != x.ConstValuesEnd ())
-    {
-      s += (*it1) * (*it1);
-      ++it1;
-    }
-  return std::sqrt (s);
+  // the squares are rounded before the sum, so that the compiler cannot
+  // contract them into fused multiply-adds in some instruction sets only
+  Values squares (x.m_values);
+  Kernels ().mul (squares.data (), squares.data (), squares.data (), squares.size ());
+  return std::sqrt (Kernels ().sum (squares.data (), squares.size ()));
 }
 
 
 double
 Sum (const SpectrumValue& x)
 {
-  double s = 0;
-  Values::const_iterator it1 = x.ConstValuesBegin ();
-  while (it1 != x.ConstValuesEnd ())
-    {
-      s += (*it1);
-      ++it1;
-    }
-  return s;
+  return Kernels ().sum (x.m_values.data (), x.m_values.size ());
 }
 
 
@@ -389,18 +819,12 @@ Prod (const SpectrumValue& x)
 double
 Integral (const SpectrumValue& arg)
 {
-  double i = 0;
-  Values::const_iterator vit = arg.ConstValuesBegin ();
-  Bands::const_iterator bit = arg.ConstBandsBegin ();
-  while (vit != arg.ConstValuesEnd ())
-    {
-      NS_ASSERT (bit != arg.ConstBandsEnd ());
-      i += (*vit) * (bit->fh - bit->fl);
-      ++vit;
-      ++bit;
-    }
-  NS_ASSERT (bit == arg.ConstBandsEnd ());
-  return i;
+  const std::vector<double> &widths = arg.m_spectrumModel->GetBandWidths ();
+  NS_ASSERT (widths.size () == arg.m_values.size ());
+  // as in Norm, the products are rounded before the sum
+  Values products (arg.m_values);
+  Kernels ().mul (products.data (), products.data (), widths.data (), products.size ());
+  return Kernels ().sum (products.data (), products.size ());
 }
 
 
@@ -408,8 +832,7 @@ Integral (const SpectrumValue& arg)
 Ptr<SpectrumValue>
 SpectrumValue::Copy () const
 {
-  Ptr<SpectrumValue> p = Create<SpectrumValue> (m_spectrumModel);
-  *p = *this;
+  Ptr<SpectrumValue> p = Create<SpectrumValue> (*this);
   return p;
 
   //  return Copy<SpectrumValue> (*this)
@@ -467,9 +890,8 @@ operator+ (double lhs, const SpectrumValue& rhs)
 SpectrumValue
 operator- (const SpectrumValue& lhs, const SpectrumValue& rhs)
 {
-  SpectrumValue res = rhs;
-  res.ChangeSign ();
-  res.Add (lhs);
+  SpectrumValue res = lhs;
+  res.Subtract (rhs);
   return res;
 }
 
@@ -26,12 +26,157 @@
 #include <ns3/spectrum-model.h>
 #include <ostream>
 #include <vector>
+#include <stdexcept>
 
 namespace ns3 {
 
 
-/// Container for element values
-typedef std::vector<double> Values;
+/**
+ * \ingroup spectrum
+ *
+ * Container for element values: a contiguous array of doubles, which the
+ * arithmetic of SpectrumValue processes with the vector instructions of
+ * the CPU.
+ *
+ * Up to INLINE_CAPACITY values, which covers the LTE bandwidths up to 100
+ * RBs, are stored in the container itself, so that a SpectrumValue of
+ * these models needs a single allocation. Larger arrays are allocated on
+ * the heap, aligned on ALIGNMENT bytes.
+ */
+class Values
+{
+public:
+  typedef double value_type;            //!< The type of the elements.
+  typedef double* iterator;             //!< Iterator over the elements.
+  typedef const double* const_iterator; //!< Const iterator over the elements.
+
+  /// The number of values stored without a heap allocation.
+  static const size_t INLINE_CAPACITY = 100;
+  /// The alignment (bytes) of the values allocated on the heap.
+  static const size_t ALIGNMENT = 32;
+
+  /// Create an empty container.
+  Values ();
+  /**
+   * Create a container of zeros.
+   * \param n the number of values
+   */
+  explicit Values (size_t n);
+  /**
+   * Copy constructor.
+   * \param o the container to copy
+   */
+  Values (const Values& o);
+  /**
+   * Move constructor.
+   * \param o the container to move
+   */
+  Values (Values&& o);
+  ~Values ();
+  /**
+   * Copy assignment.
+   * \param o the container to copy
+   * \return this container
+   */
+  Values& operator= (const Values& o);
+  /**
+   * Move assignment.
+   * \param o the container to move
+   * \return this container
+   */
+  Values& operator= (Values&& o);
+
+  /// \return the number of values
+  size_t size () const
+  {
+    return m_size;
+  }
+  /// \return a pointer to the first value
+  double* data ()
+  {
+    return m_data;
+  }
+  /// \return a pointer to the first value
+  const double* data () const
+  {
+    return m_data;
+  }
+  /// \return an iterator to the first value
+  iterator begin ()
+  {
+    return m_data;
+  }
+  /// \return an iterator past the last value
+  iterator end ()
+  {
+    return m_data + m_size;
+  }
+  /// \return an iterator to the first value
+  const_iterator begin () const
+  {
+    return m_data;
+  }
+  /// \return an iterator past the last value
+  const_iterator end () const
+  {
+    return m_data + m_size;
+  }
+  /**
+   * \param index the index of the value
+   * \return the value, without bounds checking
+   */
+  double& operator[] (size_t index)
+  {
+    return m_data[index];
+  }
+  /**
+   * \param index the index of the value
+   * \return the value, without bounds checking
+   */
+  const double& operator[] (size_t index) const
+  {
+    return m_data[index];
+  }
+  /**
+   * \param index the index of the value
+   * \return the value
+   * \throws std::out_of_range if index is not lower than size ()
+   */
+  double& at (size_t index)
+  {
+    if (index >= m_size)
+      {
+        throw std::out_of_range ("Values::at");
+      }
+    return m_data[index];
+  }
+  /**
+   * \param index the index of the value
+   * \return the value
+   * \throws std::out_of_range if index is not lower than size ()
+   */
+  const double& at (size_t index) const
+  {
+    if (index >= m_size)
+      {
+        throw std::out_of_range ("Values::at");
+      }
+    return m_data[index];
+  }
+
+private:
+  /**
+   * Set the number of values, without initializing them.
+   * \param n the number of values
+   */
+  void Resize (size_t n);
+  /// Release the heap allocation, if any.
+  void Release (void);
+
+  double *m_data;   //!< The values, m_inline or a heap allocation.
+  size_t m_size;    //!< The number of values.
+  alignas (16) double m_inline[INLINE_CAPACITY]; //!< The inline storage.
+};
 
 /**
  * \ingroup spectrum
@@ -513,6 +658,36 @@ public:
    */
   typedef void (* TracedCallback)(Ptr<SpectrumValue> value);
 
+  /**
+   * The instruction sets of the arithmetic of SpectrumValue. All of them
+   * give the same results, bit for bit: the sums of Sum, Norm and
+   * Integral are accumulated in four interleaved partial sums whatever
+   * the instruction set, and the functions of the C library are used for
+   * Pow, Log10, Log2 and Log.
+   */
+  enum InstructionSet
+  {
+    SCALAR, //!< Portable C++ loops.
+    SSE2,   //!< SSE2 kernels.
+    AVX2    //!< AVX2 kernels.
+  };
+
+  /**
+   * Select the instruction set of the arithmetic. By default, the best
+   * instruction set supported by the CPU is used.
+   * \param instructionSet the instruction set, which must be supported
+   */
+  static void SetInstructionSet (InstructionSet instructionSet);
+  /**
+   * \return the instruction set of the arithmetic
+   */
+  static InstructionSet GetInstructionSet (void);
+  /**
+   * \param instructionSet an instruction set
+   * \return true if this build and the CPU support the instruction set
+   */
+  static bool IsInstructionSetSupported (InstructionSet instructionSet);
+
 
 private:
   /**
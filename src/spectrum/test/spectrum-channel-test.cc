@@ -0,0 +1,214 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <ns3/log.h>
+#include <ns3/test.h>
+#include <ns3/simulator.h>
+#include <ns3/double.h>
+#include <ns3/object-factory.h>
+#include <ns3/spectrum-channel.h>
+#include <ns3/spectrum-phy.h>
+#include <ns3/spectrum-value.h>
+#include <ns3/spectrum-signal-parameters.h>
+#include <ns3/spectrum-model-ism2400MHz-res1MHz.h>
+#include <ns3/propagation-loss-model.h>
+#include <ns3/constant-position-mobility-model.h>
+#include <ns3/net-device.h>
+#include <ns3/antenna-model.h>
+#include <vector>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE ("SpectrumChannelTest");
+
+/**
+ * \ingroup spectrum
+ * \ingroup tests
+ *
+ * SpectrumPhy recording the signals it receives.
+ */
+class RecordingSpectrumPhy : public SpectrumPhy
+{
+public:
+  // inherited from SpectrumPhy
+  virtual void SetDevice (Ptr<NetDevice> d)
+  {
+  }
+  virtual Ptr<NetDevice> GetDevice () const
+  {
+    return 0;
+  }
+  virtual void SetMobility (Ptr<MobilityModel> m)
+  {
+    m_mobility = m;
+  }
+  virtual Ptr<MobilityModel> GetMobility ()
+  {
+    return m_mobility;
+  }
+  virtual void SetChannel (Ptr<SpectrumChannel> c)
+  {
+  }
+  virtual Ptr<const SpectrumModel> GetRxSpectrumModel () const
+  {
+    return SpectrumModelIsm2400MhzRes1Mhz;
+  }
+  virtual Ptr<AntennaModel> GetRxAntenna ()
+  {
+    return 0;
+  }
+  virtual void StartRx (Ptr<SpectrumSignalParameters> params)
+  {
+    m_received.push_back (params);
+  }
+
+  std::vector<Ptr<SpectrumSignalParameters> > m_received; //!< The received signals.
+
+private:
+  Ptr<MobilityModel> m_mobility; //!< The mobility model.
+};
+
+/**
+ * \ingroup spectrum
+ * \ingroup tests
+ *
+ * Check that the spectrum channels do not deliver the signals to the
+ * receivers beyond MaxLossDb, scale the PSD by the path gain without
+ * modifying the transmitted PSD, and deliver the same PSD to the
+ * receivers with the same path gain.
+ */
+class SpectrumChannelDeliveryTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor.
+   * \param channelType the TypeId name of the channel
+   */
+  SpectrumChannelDeliveryTestCase (std::string channelType);
+  virtual ~SpectrumChannelDeliveryTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * Create a phy attached to the channel.
+   * \param channel the channel
+   * \param position the position of the phy
+   * \return the phy
+   */
+  static Ptr<RecordingSpectrumPhy> CreatePhy (Ptr<SpectrumChannel> channel, Vector position);
+
+  std::string m_channelType; //!< The TypeId name of the channel.
+};
+
+SpectrumChannelDeliveryTestCase::SpectrumChannelDeliveryTestCase (std::string channelType)
+  : TestCase ("Check the delivery of the signals by " + channelType),
+    m_channelType (channelType)
+{
+}
+
+SpectrumChannelDeliveryTestCase::~SpectrumChannelDeliveryTestCase ()
+{
+}
+
+Ptr<RecordingSpectrumPhy>
+SpectrumChannelDeliveryTestCase::CreatePhy (Ptr<SpectrumChannel> channel, Vector position)
+{
+  Ptr<ConstantPositionMobilityModel> mobility = CreateObject<ConstantPositionMobilityModel> ();
+  mobility->SetPosition (position);
+  Ptr<RecordingSpectrumPhy> phy = CreateObject<RecordingSpectrumPhy> ();
+  phy->SetMobility (mobility);
+  channel->AddRx (phy);
+  return phy;
+}
+
+void
+SpectrumChannelDeliveryTestCase::DoRun (void)
+{
+  ObjectFactory factory;
+  factory.SetTypeId (m_channelType);
+  factory.Set ("MaxLossDb", DoubleValue (120));
+  Ptr<SpectrumChannel> channel = factory.Create<SpectrumChannel> ();
+  Ptr<LogDistancePropagationLossModel> lossModel = CreateObject<LogDistancePropagationLossModel> ();
+  channel->AddPropagationLossModel (lossModel);
+
+  Ptr<RecordingSpectrumPhy> txPhy = CreatePhy (channel, Vector (0.0, 0.0, 0.0));
+  // two co-located receivers, a receiver at another distance, and a
+  // receiver out of range
+  Ptr<RecordingSpectrumPhy> nearPhy1 = CreatePhy (channel, Vector (100.0, 0.0, 0.0));
+  Ptr<RecordingSpectrumPhy> nearPhy2 = CreatePhy (channel, Vector (100.0, 0.0, 0.0));
+  Ptr<RecordingSpectrumPhy> midPhy = CreatePhy (channel, Vector (0.0, 200.0, 0.0));
+  Ptr<RecordingSpectrumPhy> farPhy = CreatePhy (channel, Vector (10000.0, 0.0, 0.0));
+
+  Ptr<SpectrumSignalParameters> params = Create<SpectrumSignalParameters> ();
+  params->psd = Create<SpectrumValue> (SpectrumModelIsm2400MhzRes1Mhz);
+  for (uint32_t i = 0; i < params->psd->GetSpectrumModel ()->GetNumBands (); ++i)
+    {
+      (*params->psd)[i] = 1e-6 * (i + 1);
+    }
+  params->duration = MilliSeconds (1);
+  params->txPhy = txPhy;
+  SpectrumValue txPsd = *params->psd;
+  Simulator::Schedule (Seconds (1), &SpectrumChannel::StartTx, channel, params);
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  NS_TEST_ASSERT_MSG_EQ (txPhy->m_received.size (), 0, "the transmitter received its own signal");
+  NS_TEST_ASSERT_MSG_EQ (farPhy->m_received.size (), 0, "the receiver out of range received the signal");
+  NS_TEST_ASSERT_MSG_EQ (nearPhy1->m_received.size (), 1, "the first near receiver did not receive the signal");
+  NS_TEST_ASSERT_MSG_EQ (nearPhy2->m_received.size (), 1, "the second near receiver did not receive the signal");
+  NS_TEST_ASSERT_MSG_EQ (midPhy->m_received.size (), 1, "the receiver in range did not receive the signal");
+
+  Ptr<SpectrumValue> nearPsd = nearPhy1->m_received[0]->psd;
+  Ptr<SpectrumValue> midPsd = midPhy->m_received[0]->psd;
+  NS_TEST_ASSERT_MSG_EQ (nearPsd, nearPhy2->m_received[0]->psd, "the co-located receivers do not share the PSD");
+  NS_TEST_ASSERT_MSG_NE (nearPsd, midPsd, "the receivers at different distances share the PSD");
+  NS_TEST_ASSERT_MSG_NE (nearPsd, params->psd, "the receivers share the transmitted PSD");
+  NS_TEST_ASSERT_MSG_EQ (nearPhy1->m_received[0]->txPhy, txPhy, "wrong transmitter");
+
+  double nearGain = std::pow (10.0, lossModel->CalcRxPower (0, txPhy->GetMobility (), nearPhy1->GetMobility ()) / 10.0);
+  double midGain = std::pow (10.0, lossModel->CalcRxPower (0, txPhy->GetMobility (), midPhy->GetMobility ()) / 10.0);
+  for (uint32_t i = 0; i < txPsd.GetSpectrumModel ()->GetNumBands (); ++i)
+    {
+      NS_TEST_ASSERT_MSG_EQ ((*params->psd)[i], txPsd[i], "the transmitted PSD was modified");
+      NS_TEST_ASSERT_MSG_EQ_TOL ((*nearPsd)[i], txPsd[i] * nearGain, txPsd[i] * nearGain * 1e-12,
+                                 "wrong PSD at the near receivers");
+      NS_TEST_ASSERT_MSG_EQ_TOL ((*midPsd)[i], txPsd[i] * midGain, txPsd[i] * midGain * 1e-12,
+                                 "wrong PSD at the receiver in range");
+    }
+}
+
+
+/**
+ * \ingroup spectrum
+ * \ingroup tests
+ *
+ * Test suite of the delivery of the signals by the spectrum channels.
+ */
+class SpectrumChannelTestSuite : public TestSuite
+{
+public:
+  SpectrumChannelTestSuite ();
+};
+
+SpectrumChannelTestSuite::SpectrumChannelTestSuite ()
+  : TestSuite ("spectrum-channel", UNIT)
+{
+  AddTestCase (new SpectrumChannelDeliveryTestCase ("ns3::SingleModelSpectrumChannel"), TestCase::QUICK);
+  AddTestCase (new SpectrumChannelDeliveryTestCase ("ns3::MultiModelSpectrumChannel"), TestCase::QUICK);
+}
+
+static SpectrumChannelTestSuite g_spectrumChannelTestSuite;
@@ -0,0 +1,213 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <ns3/log.h>
+#include <ns3/test.h>
+#include <ns3/simulator.h>
+#include <ns3/boolean.h>
+#include <ns3/double.h>
+#include <ns3/multi-model-spectrum-channel.h>
+#include <ns3/spectrum-analyzer.h>
+#include <ns3/spectrum-signal-parameters.h>
+#include <ns3/spectrum-model-ism2400MHz-res1MHz.h>
+#include <ns3/propagation-loss-model.h>
+#include <ns3/constant-position-mobility-model.h>
+#include <ns3/constant-velocity-mobility-model.h>
+#include <ns3/cosine-antenna-model.h>
+#include <algorithm>
+#include <vector>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE ("SpectrumPathLossCacheTest");
+
+/**
+ * \ingroup spectrum
+ * \ingroup tests
+ *
+ * Log-distance propagation loss model counting its evaluations.
+ */
+class CountingPropagationLossModel : public PropagationLossModel
+{
+public:
+  CountingPropagationLossModel ()
+    : m_calls (0)
+  {
+  }
+
+  /**
+   * \return the number of evaluations of the model
+   */
+  uint32_t GetCalls (void) const
+  {
+    return m_calls;
+  }
+
+private:
+  virtual double DoCalcRxPower (double txPowerDbm,
+                                Ptr<MobilityModel> a,
+                                Ptr<MobilityModel> b) const
+  {
+    ++m_calls;
+    return txPowerDbm - 40.0 - 30.0 * std::log10 (std::max (a->GetDistanceFrom (b), 1.0));
+  }
+  virtual int64_t DoAssignStreams (int64_t stream)
+  {
+    return 0;
+  }
+
+  mutable uint32_t m_calls; //!< The number of evaluations.
+};
+
+/**
+ * \ingroup spectrum
+ * \ingroup tests
+ *
+ * Check that the path loss cache of MultiModelSpectrumChannel gives the
+ * same path losses as the uncached computation, and that the path losses
+ * are only computed again when the transmitter or the receiver moved.
+ */
+class SpectrumPathLossCacheTestCase : public TestCase
+{
+public:
+  SpectrumPathLossCacheTestCase ();
+  virtual ~SpectrumPathLossCacheTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * Trace sink of the path losses.
+   * \param losses the path losses of the channel
+   * \param txPhy the transmitter
+   * \param rxPhy the receiver
+   * \param lossDb the path loss (dB)
+   */
+  static void PathLoss (std::vector<double> *losses, Ptr<const SpectrumPhy> txPhy,
+                        Ptr<const SpectrumPhy> rxPhy, double lossDb);
+};
+
+SpectrumPathLossCacheTestCase::SpectrumPathLossCacheTestCase ()
+  : TestCase ("Check the path loss cache of MultiModelSpectrumChannel")
+{
+}
+
+SpectrumPathLossCacheTestCase::~SpectrumPathLossCacheTestCase ()
+{
+}
+
+void
+SpectrumPathLossCacheTestCase::PathLoss (std::vector<double> *losses, Ptr<const SpectrumPhy> txPhy,
+                                         Ptr<const SpectrumPhy> rxPhy, double lossDb)
+{
+  losses->push_back (lossDb);
+}
+
+void
+SpectrumPathLossCacheTestCase::DoRun (void)
+{
+  // the transmitter and the receivers are shared by the two channels
+  Ptr<ConstantPositionMobilityModel> txMobility = CreateObject<ConstantPositionMobilityModel> ();
+  txMobility->SetPosition (Vector (0.0, 0.0, 10.0));
+  Ptr<ConstantPositionMobilityModel> staticMobility = CreateObject<ConstantPositionMobilityModel> ();
+  staticMobility->SetPosition (Vector (100.0, 50.0, 1.5));
+  Ptr<ConstantVelocityMobilityModel> movingMobility = CreateObject<ConstantVelocityMobilityModel> ();
+  movingMobility->SetPosition (Vector (-200.0, 0.0, 1.5));
+  movingMobility->SetVelocity (Vector (3.0, 1.0, 0.0));
+  Ptr<ConstantPositionMobilityModel> movedMobility = CreateObject<ConstantPositionMobilityModel> ();
+  movedMobility->SetPosition (Vector (0.0, 300.0, 1.5));
+  Simulator::Schedule (Seconds (2.5), &ConstantPositionMobilityModel::SetPosition,
+                       movedMobility, Vector (0.0, -300.0, 1.5));
+  Ptr<CosineAntennaModel> txAntenna = CreateObject<CosineAntennaModel> ();
+  txAntenna->SetAttribute ("Orientation", DoubleValue (30.0));
+
+  std::vector<Ptr<MobilityModel> > rxMobilities;
+  rxMobilities.push_back (staticMobility);
+  rxMobilities.push_back (movingMobility);
+  rxMobilities.push_back (movedMobility);
+
+  std::vector<double> losses[2];
+  Ptr<CountingPropagationLossModel> lossModels[2];
+  for (uint32_t cache = 0; cache < 2; ++cache)
+    {
+      Ptr<MultiModelSpectrumChannel> channel = CreateObject<MultiModelSpectrumChannel> ();
+      channel->SetAttribute ("EnablePathLossCache", BooleanValue (cache == 1));
+      lossModels[cache] = CreateObject<CountingPropagationLossModel> ();
+      channel->AddPropagationLossModel (lossModels[cache]);
+      channel->TraceConnectWithoutContext ("PathLoss",
+                                           MakeBoundCallback (&SpectrumPathLossCacheTestCase::PathLoss,
+                                                              &losses[cache]));
+
+      Ptr<SpectrumAnalyzer> txPhy = CreateObject<SpectrumAnalyzer> ();
+      txPhy->SetRxSpectrumModel (SpectrumModelIsm2400MhzRes1Mhz);
+      txPhy->SetMobility (txMobility);
+      for (uint32_t i = 0; i < rxMobilities.size (); ++i)
+        {
+          Ptr<SpectrumAnalyzer> rxPhy = CreateObject<SpectrumAnalyzer> ();
+          rxPhy->SetRxSpectrumModel (SpectrumModelIsm2400MhzRes1Mhz);
+          rxPhy->SetMobility (rxMobilities[i]);
+          channel->AddRx (rxPhy);
+        }
+
+      for (uint32_t t = 1; t <= 4; ++t)
+        {
+          Ptr<SpectrumSignalParameters> params = Create<SpectrumSignalParameters> ();
+          params->psd = Create<SpectrumValue> (SpectrumModelIsm2400MhzRes1Mhz);
+          *(params->psd) = 1e-9;
+          params->duration = MilliSeconds (1);
+          params->txPhy = txPhy;
+          params->txAntenna = txAntenna;
+          Simulator::Schedule (Seconds (t), &MultiModelSpectrumChannel::StartTx, channel, params);
+        }
+    }
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  NS_TEST_ASSERT_MSG_EQ (losses[0].size (), 12, "wrong number of path losses without the cache");
+  NS_TEST_ASSERT_MSG_EQ (losses[1].size (), 12, "wrong number of path losses with the cache");
+  // the receivers are not traced in the same order on the two channels
+  std::sort (losses[0].begin (), losses[0].end ());
+  std::sort (losses[1].begin (), losses[1].end ());
+  for (uint32_t i = 0; i < losses[0].size (); ++i)
+    {
+      NS_TEST_ASSERT_MSG_EQ (losses[1][i], losses[0][i], "cached path loss " << i << " differs");
+    }
+  NS_TEST_ASSERT_MSG_EQ (lossModels[0]->GetCalls (), 12, "wrong number of evaluations without the cache");
+  // 3 receivers at the first transmission, then the moving receiver at
+  // each transmission, and the moved receiver at the third one
+  NS_TEST_ASSERT_MSG_EQ (lossModels[1]->GetCalls (), 7, "wrong number of evaluations with the cache");
+}
+
+
+/**
+ * \ingroup spectrum
+ * \ingroup tests
+ *
+ * Test suite of the path loss cache of MultiModelSpectrumChannel.
+ */
+class SpectrumPathLossCacheTestSuite : public TestSuite
+{
+public:
+  SpectrumPathLossCacheTestSuite ();
+};
+
+SpectrumPathLossCacheTestSuite::SpectrumPathLossCacheTestSuite ()
+  : TestSuite ("spectrum-pathloss-cache", UNIT)
+{
+  AddTestCase (new SpectrumPathLossCacheTestCase, TestCase::QUICK);
+}
+
+static SpectrumPathLossCacheTestSuite g_spectrumPathLossCacheTestSuite;
@@ -25,6 +25,7 @@
 #include <ns3/test.h>
 #include <iostream>
 #include <cmath>
+#include <numeric>
 
 #include "spectrum-test.h"
 
@@ -82,6 +83,135 @@ SpectrumValueTestCase::DoRun (void)
 
 
 
+/**
+ * \ingroup spectrum
+ * \ingroup tests
+ *
+ * Check that all the instruction sets supported by the CPU give the same
+ * results, bit for bit, as the SCALAR instruction set, for spectrum models
+ * of several sizes, stored inline and on the heap, and that copying the
+ * values between the two storages preserves them.
+ */
+class SpectrumValueInstructionSetTestCase : public TestCase
+{
+public:
+  SpectrumValueInstructionSetTestCase ();
+  virtual ~SpectrumValueInstructionSetTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * Compute the results of the arithmetic with the current instruction set.
+   * \param a the first operand
+   * \param b the second operand
+   * \return the elementwise results followed by the reductions
+   */
+  static std::vector<double> Compute (const SpectrumValue& a, const SpectrumValue& b);
+};
+
+SpectrumValueInstructionSetTestCase::SpectrumValueInstructionSetTestCase ()
+  : TestCase ("Check the instruction sets of the SpectrumValue arithmetic")
+{
+}
+
+SpectrumValueInstructionSetTestCase::~SpectrumValueInstructionSetTestCase ()
+{
+}
+
+std::vector<double>
+SpectrumValueInstructionSetTestCase::Compute (const SpectrumValue& a, const SpectrumValue& b)
+{
+  SpectrumValue results[] = {
+    a + b, a - b, a * b, a / b,
+    a + 0.3, a - 0.3, a * 0.3, a / 0.3,
+    1.7 - a, 1.7 / a, -a,
+    Pow (a, 1.5), Pow (10.0, b), Log10 (a), Log2 (a), Log (a)
+  };
+  std::vector<double> values;
+  for (uint32_t i = 0; i < sizeof (results) / sizeof (results[0]); ++i)
+    {
+      values.insert (values.end (), results[i].ConstValuesBegin (), results[i].ConstValuesEnd ());
+    }
+  SpectrumValue c = a;
+  c += b;
+  c *= a;
+  c -= 0.5;
+  c /= b;
+  values.insert (values.end (), c.ConstValuesBegin (), c.ConstValuesEnd ());
+  values.push_back (Sum (a));
+  values.push_back (Sum (c));
+  values.push_back (Norm (b));
+  values.push_back (Integral (a));
+  values.push_back (Integral (c));
+  return values;
+}
+
+void
+SpectrumValueInstructionSetTestCase::DoRun (void)
+{
+  SpectrumValue::InstructionSet defaultInstructionSet = SpectrumValue::GetInstructionSet ();
+  NS_TEST_ASSERT_MSG_EQ (SpectrumValue::IsInstructionSetSupported (defaultInstructionSet), true,
+                         "the default instruction set is not supported");
+
+  uint32_t sizes[] = { 1, 2, 3, 4, 5, 7, 25, 50, 99, 100, 101, 275 };
+  for (uint32_t s = 0; s < sizeof (sizes) / sizeof (sizes[0]); ++s)
+    {
+      uint32_t n = sizes[s];
+      Bands bands;
+      for (uint32_t i = 0; i < n; ++i)
+        {
+          BandInfo band;
+          band.fl = 1e9 + i * 180e3;
+          band.fc = band.fl + 90e3;
+          band.fh = band.fl + 180e3 + 10e3 * (i % 3);
+          bands.push_back (band);
+        }
+      Ptr<SpectrumModel> model = Create<SpectrumModel> (bands);
+      SpectrumValue a (model);
+      SpectrumValue b (model);
+      for (uint32_t i = 0; i < n; ++i)
+        {
+          a[i] = 1.5 + std::sin (0.37 * i) * 1e-3 * (i + 1);
+          b[i] = 2.5e-13 * (1 + std::cos (1.3 * i) / 3);
+        }
+
+      SpectrumValue::SetInstructionSet (SpectrumValue::SCALAR);
+      std::vector<double> expected = Compute (a, b);
+      NS_TEST_ASSERT_MSG_EQ_TOL (expected[expected.size () - 5], std::accumulate (a.ConstValuesBegin (), a.ConstValuesEnd (), 0.0),
+                                 1e-12 * n, "wrong sum of " << n << " values");
+      for (uint32_t set = SpectrumValue::SSE2; set <= SpectrumValue::AVX2; ++set)
+        {
+          SpectrumValue::InstructionSet instructionSet = static_cast<SpectrumValue::InstructionSet> (set);
+          if (!SpectrumValue::IsInstructionSetSupported (instructionSet))
+            {
+              continue;
+            }
+          SpectrumValue::SetInstructionSet (instructionSet);
+          std::vector<double> actual = Compute (a, b);
+          NS_TEST_ASSERT_MSG_EQ (actual.size (), expected.size (), "wrong number of results");
+          for (uint32_t i = 0; i < actual.size (); ++i)
+            {
+              NS_TEST_ASSERT_MSG_EQ (actual[i], expected[i], "result " << i << " of " << n
+                                     << " values differs with instruction set " << set);
+            }
+        }
+
+      // copies between the inline and the heap storages
+      Ptr<SpectrumValue> copy = a.Copy ();
+      SpectrumValue other (Create<SpectrumModel> (std::vector<double> (sizes, sizes + 2)));
+      other = a;
+      SpectrumValue moved (std::move (*copy));
+      for (uint32_t i = 0; i < n; ++i)
+        {
+          NS_TEST_ASSERT_MSG_EQ (other[i], a[i], "wrong copy of value " << i << " of " << n);
+          NS_TEST_ASSERT_MSG_EQ (moved[i], a[i], "wrong move of value " << i << " of " << n);
+        }
+    }
+  SpectrumValue::SetInstructionSet (defaultInstructionSet);
+}
+
+
 class SpectrumValueTestSuite : public TestSuite
 {
 public:
@@ -241,6 +371,8 @@ SpectrumValueTestSuite::SpectrumValueTestSuite ()
   tv1rs3 = v1 >> 3;
   AddTestCase (new SpectrumValueTestCase (tv1rs3, v1rs3, "tv1rs3 = v1 >> 3"), TestCase::QUICK);
 
+  AddTestCase (new SpectrumValueInstructionSetTestCase, TestCase::QUICK);
+
 
 }
 
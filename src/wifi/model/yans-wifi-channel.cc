@@ -114,11 +114,11 @@ YansWifiChannel::Send (Ptr<YansWifiPhy> sender, Ptr<const Packet> packet, double
               dstNode = dstNetDevice->GetNode ()->GetId ();
             }
 
-          Simulator::ScheduleWithContext (dstNode,
-                                          delay, &YansWifiChannel::Receive,
-                                          (*i), copy, rxPowerDbm, duration);
+          m_receptions.Add (dstNode, delay, &YansWifiChannel::Receive,
+                            (*i), copy, rxPowerDbm, duration);
         }
     }
+  Simulator::ScheduleBatch (m_receptions);
 }
 
 void
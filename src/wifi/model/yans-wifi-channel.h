@@ -22,6 +22,7 @@
 #define YANS_WIFI_CHANNEL_H
 
 #include "ns3/channel.h"
+#include "ns3/event-batch.h"
 
 namespace ns3 {
 
@@ -119,6 +120,7 @@ private:
   PhyList m_phyList;                   //!< List of YansWifiPhys connected to this YansWifiChannel
   Ptr<PropagationLossModel> m_loss;    //!< Propagation loss model
   Ptr<PropagationDelayModel> m_delay;  //!< Propagation delay model
+  mutable EventBatch m_receptions;     //!< Receptions scheduled by Send, kept to reuse its storage
 };
 
 } //namespace ns3
@@ -204,6 +204,7 @@ int main (int argc, char *argv[])
 {
 
   bool schedCal  = false;
+  bool schedDary = false;
   bool schedHeap = false;
   bool schedList = false;
   bool schedMap  = true;
@@ -223,6 +224,7 @@ int main (int argc, char *argv[])
              "In the case of either --file form, the input is expected\n"
              "to be ascii, giving the relative event times in ns.");
   cmd.AddValue ("cal",   "use CalendarSheduler",          schedCal);
+  cmd.AddValue ("dary",  "use DaryHeapScheduler",         schedDary);
   cmd.AddValue ("heap",  "use HeapScheduler",             schedHeap);
   cmd.AddValue ("list",  "use ListSheduler",              schedList);
   cmd.AddValue ("map",   "use MapScheduler (default)",    schedMap);
@@ -241,6 +243,10 @@ int main (int argc, char *argv[])
     {
       factory.SetTypeId ("ns3::CalendarScheduler");
     }
+  if (schedDary)
+    {
+      factory.SetTypeId ("ns3::DaryHeapScheduler");
+    }
   if (schedHeap)
     {
       factory.SetTypeId ("ns3::HeapScheduler");